@@ -4,7 +4,7 @@ CONFIG -= app_bundle
 CONFIG -= qt
 # QT += core
 
-LIBS += -lwinmm
+LIBS += -lwinmm -ladvapi32
 
 VERSION = 0.31.1
 DEFINES += PRG_VERSION=\\\"$$VERSION\\\" \
@@ -19,9 +19,11 @@ QMAKE_CXXFLAGS_RELEASE += -flto
 
 RC_ICONS = icon_256.ico
 
+# Prüf-Build (qmake CONFIG+=alloccheck): zählt Heap-Allokationen in der Tick-Schleife
+alloccheck: DEFINES += TEEFAX_COUNT_ALLOCS
+
 SOURCES += \
         main.cpp
 
 HEADERS += \
-    i18n.h \
-    sound_array.h
\ No newline at end of file
+    i18n.h
\ No newline at end of file
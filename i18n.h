@@ -65,6 +65,52 @@ enum class Str {
     WARN_ALARM_REPEAT_TOO_LARGE,
     WARN_PATH_TOO_LONG,
     WARN_TIMER_PERIOD,
+    ERROR_INVALID_AUDIO_BACKEND,
+    CALIBRATE_START,
+    CALIBRATE_RESULT,
+    CALIBRATE_SAVED,
+    CALIBRATE_SAVE_FAILED,
+    CALIBRATE_FAILED,
+    ERROR_INVALID_TONE,
+    ERROR_UNSUPPORTED_SOUND,
+    ERROR_INVALID_METRONOME,
+    ERROR_INVALID_ACCENT,
+    METRONOME_LABEL,
+    METRONOME_HINT,
+    ERROR_INVALID_OUTPUT,
+    ERROR_INVALID_OUTPUT_TICK,
+    ERROR_INVALID_BAR,
+    ERROR_INVALID_FPS,
+    TIMER_KEYS_HINT,
+    TIMER_CANCELLED,
+    LAP_LINE,
+    LAPS_SKIPPED,
+    LAPS_SAVED,
+    LAPS_SAVE_FAILED,
+    SW_MISSING_NAME,
+    SW_INVALID_NAME,
+    SW_INVALID_SUBCMD,
+    SW_STORE_ERROR,
+    SW_STORE_FULL,
+    SW_NOT_FOUND,
+    SW_REMOVED,
+    STATUS_HEADER,
+    STATUS_STATE_RUNNING,
+    STATUS_STATE_PAUSED,
+    STATUS_STATE_ALARM,
+    STATUS_NONE,
+    ATTACH_MISSING_ID,
+    ATTACH_NOT_FOUND,
+    ATTACH_ENDED,
+    CONTROL_USAGE,
+    CONTROL_SENT,
+    CONTROL_FAILED,
+    MACRO_SAVE_FAILED,
+    MACRO_CYCLE,
+    MACRO_MISSING_PARAMS,
+    CONFIG_RELOADED,
+    CONFIG_RELOAD_FAILED,
+    CALIBRATE_NEEDS_DEVICE,
     _COUNT
 };
 
@@ -120,16 +166,32 @@ static const TranslationMap LANG_DE = {
         "  -a,  --at YYYY-MM-DD        Bis zum angegebenen Datum zaehlen\n"
         "  -a,  --at YYYY-MM-DD HH:MM  Datum und Uhrzeit kombiniert\n"
         "  -as, --async                Ton asynchron abspielen\n"
+        "       --audio-backend <b>    Audioausgabe: winmm (Standard), null, wav:<Datei>\n"
+        "       --tone <name>          Eingebauter Weckton: chime (Standard), beep, gong\n"
+        "       --metronome <bpm>      Metronom (ohne Zeit: bis Strg+C)\n"
+        "       --beep-every <Dauer>   Piep in festem Abstand (z. B. 30s)\n"
+        "       --accent <Muster>      Betonung je Schlag: X betont, x normal, . Pause\n"
+        "       --calibrate-audio      Audio-Latenz messen und in teefax.ini speichern\n"
+        "       --bar <Stil>           Balken: classic (Standard) oder smooth (Achtelbloecke)\n"
+        "       --output <Format>      Ausgabe: text (Standard) oder jsonl (Ereignisse)\n"
+        "       --output-tick <Dauer>  Abstand der jsonl-Tick-Ereignisse (Standard: 1s)\n"
         "  -s,  --sound <Datei>        Benutzerdefinierte Sounddatei\n"
         "  -o,  --open <Dateipfad>     Datei nach Ablauf oeffnen\n"
         "  -c,  --cmd  <Befehl>        Konsolenbefehl nach Ablauf ausfuehren\n"
         "  -ns, --nosleep              Bildschirmschoner unterdruecken\n"
         "       --eco                  Energiesparmodus (empfohlen fuer Akkubetrieb und aelteres Windows)\n"
+        "       --watch-config         teefax.ini beobachten, Aenderungen ab dem naechsten Durchlauf uebernehmen\n"
         "       --nomsg                Kein Benachrichtigungsfenster\n"
         "       <Notiz>                Eigene Notiz, in Anfuehrungszeichen (ohne Optionsname)\n"
         "  -pa, --prealarm <s>         Sekuendlicher Beep X Sekunden vor Ablauf\n"
         "  -t,  --time                 Direktanzeige Datum & Zeit\n"
         "  -sw, --stopwatch            Stoppuhr starten (Beenden mit Strg+C)\n"
+        "       --fps <n>              Bildrate der Stoppuhr (Standard: 100)\n"
+        "       --laps <datei>         Runden der Stoppuhr beim Beenden speichern (.json, sonst CSV)\n"
+        "       --sw <name> <bef>      Benannte Stoppuhr: start, stop, lap, reset, remove, show\n"
+        "       --status               Laufende Timer auflisten (ID, Restzeit, Notiz)\n"
+        "       --attach <id>          Balken eines laufenden Timers live anzeigen\n"
+        "       --control <id> <cmd>   Laufenden Timer steuern: pause|resume|cancel|add|sub|target\n"
         "  -d,  --daily HH:mm[:ss]     Taeglicher Alarm\n"
         "  -e,  --every <Tage> [HH:mm] Woechentlich/monatlich (z.B. mon,fri oder 1,15)\n"
         "  -f,  --focus <Titel>        Fenster nach Ablauf in Vordergrund holen\n"
@@ -164,7 +226,7 @@ static const TranslationMap LANG_DE = {
     { Str::OPEN_TARGET,      " | Oeffnet: \"%s\"" },
     { Str::STOPWATCH_LABEL,  "Stoppuhr" },
     { Str::ELAPSED,          "Vergangen: %s" },
-    { Str::STOPWATCH_HINT,   "Leertaste oder P: Pause/Weiter | R: Zuruecksetzen | Strg+C: Beenden" },
+    { Str::STOPWATCH_HINT,   "Leertaste oder P: Pause/Weiter | L oder Enter: Runde | R: Zuruecksetzen | E: Runden speichern | Esc oder Q: Beenden" },
     { Str::STOPWATCH_PAUSED, "[PAUSIERT]" },
     { Str::MACRO_ADDED,           "Makro '%s' gespeichert." },
     { Str::MACRO_OVERWRITE_PROMPT,"Makro '%s' existiert bereits. Ueberschreiben? [j/n]: " },
@@ -187,6 +249,52 @@ static const TranslationMap LANG_DE = {
     { Str::WARN_ALARM_REPEAT_TOO_LARGE, "Warnung: --alarm-repeat-Wert '%s' zu gross, verwende Maximum (%lld)." },
     { Str::WARN_PATH_TOO_LONG,          "Warnung: Pfad zu teefax.exe zu lang (>=%d Zeichen). teefax.ini wird ignoriert." },
     { Str::WARN_TIMER_PERIOD,           "Warnung: timeBeginPeriod(1) fehlgeschlagen. Schlafpraezision ca. ~15ms statt ~1ms." },
+    { Str::ERROR_INVALID_AUDIO_BACKEND, "Ungueltiges Audio-Backend: '%s' (erlaubt: winmm, null, wav:<Datei>)." },
+    { Str::CALIBRATE_START,             "Messe Audio-Latenz des aktuellen Ausgabegeraets (%d Durchlaeufe) ..." },
+    { Str::CALIBRATE_RESULT,            "Geraet oeffnen: %lld ms | Ausgabelatenz: %lld ms" },
+    { Str::CALIBRATE_SAVED,             "Werte in teefax.ini gespeichert (--audio-open-ms, --audio-latency-ms)." },
+    { Str::CALIBRATE_SAVE_FAILED,       "Fehler: teefax.ini konnte nicht geschrieben werden." },
+    { Str::CALIBRATE_FAILED,            "Fehler: Audiogeraet konnte nicht geoeffnet werden." },
+    { Str::ERROR_INVALID_TONE,          "Unbekannter Klang: '%s' (erlaubt: chime, beep, gong)." },
+    { Str::ERROR_UNSUPPORTED_SOUND,     "Audiodatei kann nicht gelesen werden: %s (unterstuetzt: WAV mit PCM 8/16/24/32 Bit, Float oder IMA-ADPCM)." },
+    { Str::ERROR_INVALID_METRONOME,     "Ungueltiger Takt: '%s' (--metronome: BPM bis 1200, --beep-every: mindestens 50ms)." },
+    { Str::ERROR_INVALID_ACCENT,        "Ungueltiges Betonungsmuster: '%s' (erlaubt: X = betont, x = normal, . = Pause)." },
+    { Str::METRONOME_LABEL,             "Metronom" },
+    { Str::METRONOME_HINT,              "%.1f Schlaege/min, Muster %s | Strg+C: Beenden" },
+    { Str::ERROR_INVALID_OUTPUT,        "Ungueltiges Ausgabeformat: '%s' (erlaubt: text, jsonl)." },
+    { Str::ERROR_INVALID_OUTPUT_TICK,   "Ungueltiger Tick-Abstand: '%s' (mindestens 10ms)." },
+    { Str::ERROR_INVALID_BAR,           "Ungueltiger Balkenstil: '%s' (erlaubt: classic, smooth)." },
+    { Str::ERROR_INVALID_FPS,           "Ungueltige Bildrate: '%s' (1 bis %d)." },
+    { Str::TIMER_KEYS_HINT,             "Leertaste oder P: Pause/Weiter | +: eine Minute mehr | S (beim Alarm): 5 Min. schlummern | Esc oder Q: Abbrechen" },
+    { Str::TIMER_CANCELLED,             "Zaehler abgebrochen." },
+    { Str::LAP_LINE,                    "Runde %llu: %s (gesamt %s)" },
+    { Str::LAPS_SKIPPED,                "... %llu Runden nicht angezeigt (im Export enthalten)" },
+    { Str::LAPS_SAVED,                  "%llu Runden gespeichert: %s" },
+    { Str::LAPS_SAVE_FAILED,            "Fehler: Runden konnten nicht gespeichert werden: %s" },
+    { Str::SW_MISSING_NAME,             "Fehler: --sw erwartet einen Namen, z. B. --sw build start" },
+    { Str::SW_INVALID_NAME,             "Fehler: Ungueltiger Stoppuhr-Name '%s' (1-31 Zeichen: Buchstaben, Ziffern, - _ .)" },
+    { Str::SW_INVALID_SUBCMD,           "Fehler: Unbekannter Stoppuhr-Befehl '%s' (start, stop, lap, reset, remove, show)" },
+    { Str::SW_STORE_ERROR,              "Fehler: teefax-stopwatches.dat neben teefax.exe kann nicht geoeffnet werden." },
+    { Str::SW_STORE_FULL,               "Fehler: Kein Platz fuer Stoppuhr '%s' (hoechstens 64; mit 'remove' freigeben)." },
+    { Str::SW_NOT_FOUND,                "Stoppuhr '%s' nicht gefunden." },
+    { Str::SW_REMOVED,                  "Stoppuhr '%s' entfernt." },
+    { Str::STATUS_HEADER,               "ID       Modus      Status       Restzeit   Durchlauf Notiz" },
+    { Str::STATUS_STATE_RUNNING,        "laeuft" },
+    { Str::STATUS_STATE_PAUSED,         "pausiert" },
+    { Str::STATUS_STATE_ALARM,          "Alarm" },
+    { Str::STATUS_NONE,                 "Keine laufenden Timer." },
+    { Str::ATTACH_MISSING_ID,           "Fehler: --attach erwartet eine ID aus --status." },
+    { Str::ATTACH_NOT_FOUND,            "Kein laufender Timer mit ID '%s' (siehe --status)." },
+    { Str::ATTACH_ENDED,                "Timer %u beendet." },
+    { Str::CONTROL_USAGE,               "Aufruf: --control <id> pause|resume|cancel|add <Dauer>|sub <Dauer>|target <HH:MM[:SS]|Dauer>" },
+    { Str::CONTROL_SENT,                "Befehl '%s' an Timer %s gesendet." },
+    { Str::CONTROL_FAILED,              "Fehler: Befehl '%s' wurde von Timer %s nicht angenommen." },
+    { Str::MACRO_SAVE_FAILED,           "Fehler: teefax.ini konnte nicht geschrieben werden." },
+    { Str::MACRO_CYCLE,                 "Fehler: Makro '%s' ruft sich selbst auf (Zyklus)." },
+    { Str::MACRO_MISSING_PARAMS,        "Fehler: Makro '%s' erwartet %d Argument(e)." },
+    { Str::CONFIG_RELOADED,             "teefax.ini neu geladen (Ton, Voralarm, Wiederholungen, Aktionen)." },
+    { Str::CONFIG_RELOAD_FAILED,        "Warnung: teefax.ini enthaelt Fehler, bisherige Einstellungen bleiben aktiv." },
+    { Str::CALIBRATE_NEEDS_DEVICE,      "Fehler: --calibrate-audio misst nur ein echtes Ausgabegeraet (nicht mit --audio-backend null/wav:)." },
     };
 
 static const TranslationMap LANG_FR = {
@@ -238,16 +346,32 @@ static const TranslationMap LANG_FR = {
         "  -a,  --at YYYY-MM-DD        Compter jusqu'a la date indiquee\n"
         "  -a,  --at YYYY-MM-DD HH:MM  Date et heure combinees\n"
         "  -as, --async                Jouer le son en mode asynchrone\n"
+        "       --audio-backend <b>    Sortie audio : winmm (defaut), null, wav:<fichier>\n"
+        "       --tone <name>          Son integre : chime (defaut), beep, gong\n"
+        "       --metronome <bpm>      Metronome (sans duree : jusqu'a Ctrl+C)\n"
+        "       --beep-every <duree>   Bip a intervalle fixe (ex. 30s)\n"
+        "       --accent <motif>       Accent par temps : X accentue, x normal, . silence\n"
+        "       --calibrate-audio      Mesurer la latence audio et l'enregistrer dans teefax.ini\n"
+        "       --bar <style>          Barre : classic (defaut) ou smooth (huitiemes de bloc)\n"
+        "       --output <format>      Sortie : text (defaut) ou jsonl (evenements)\n"
+        "       --output-tick <duree>  Intervalle des ticks jsonl (defaut : 1s)\n"
         "  -s,  --sound <fichier>      Son d'alarme personnalise\n"
         "  -o,  --open <chemin>        Ouvrir un fichier apres le compteur\n"
         "  -c,  --cmd  <commande>      Executer une commande apres le compteur\n"
         "  -ns, --nosleep              Empecher la mise en veille\n"
         "       --eco                  Mode eco (recommande sur batterie ou ancien Windows)\n"
+        "       --watch-config         Surveiller teefax.ini, appliquer les changements au prochain cycle\n"
         "       --nomsg                Pas de fenetre de notification\n"
         "       <note>                 Note entre guillemets (sans nom d'option)\n"
         "  -pa, --prealarm <s>         Bip chaque seconde X secondes avant la fin\n"
         "  -t,  --time                 Affichage en direct de la date et l'heure\n"
         "  -sw, --stopwatch            Demarrer le chronometre (Ctrl+C pour quitter)\n"
+        "       --fps <n>              Images par seconde du chronometre (defaut : 100)\n"
+        "       --laps <fichier>       Enregistrer les tours du chronometre a la sortie (.json, sinon CSV)\n"
+        "       --sw <nom> <cmd>       Chronometre nomme : start, stop, lap, reset, remove, show\n"
+        "       --status               Lister les minuteurs en cours (ID, temps restant, note)\n"
+        "       --attach <id>          Afficher en direct la barre d'un minuteur en cours\n"
+        "       --control <id> <cmd>   Piloter un minuteur: pause|resume|cancel|add|sub|target\n"
         "  -d,  --daily HH:mm[:ss]     Alarme quotidienne\n"
         "  -e,  --every <jours> [HH:mm] Hebdomadaire/mensuel (ex. mon,fri ou 1,15)\n"
         "  -f,  --focus <titre>        Mettre une fenetre au premier plan apres le compte\n"
@@ -282,7 +406,7 @@ static const TranslationMap LANG_FR = {
     { Str::OPEN_TARGET,      " | Ouvre: \"%s\"" },
     { Str::STOPWATCH_LABEL,  "Chronometre" },
     { Str::ELAPSED,          "Ecoule: %s" },
-    { Str::STOPWATCH_HINT,   "Espace ou P: Pause/Reprendre | R: Reinitialiser | Ctrl+C: Quitter" },
+    { Str::STOPWATCH_HINT,   "Espace ou P: Pause/Reprendre | L ou Entree: Tour | R: Reinitialiser | E: Enregistrer les tours | Echap ou Q: Quitter" },
     { Str::STOPWATCH_PAUSED, "[EN PAUSE]" },
     { Str::MACRO_ADDED,           "Macro '%s' enregistre." },
     { Str::MACRO_OVERWRITE_PROMPT,"Le macro '%s' existe deja. Ecraser? [o/n]: " },
@@ -305,6 +429,52 @@ static const TranslationMap LANG_FR = {
     { Str::WARN_ALARM_REPEAT_TOO_LARGE, "Avertissement: valeur --alarm-repeat '%s' trop grande, utilise le maximum (%lld)." },
     { Str::WARN_PATH_TOO_LONG,          "Avertissement: chemin vers teefax.exe trop long (>=%d caracteres). teefax.ini sera ignore." },
     { Str::WARN_TIMER_PERIOD,           "Avertissement: timeBeginPeriod(1) echoue. Precision du sommeil ~15ms au lieu de ~1ms." },
+    { Str::ERROR_INVALID_AUDIO_BACKEND, "Backend audio invalide : '%s' (autorises : winmm, null, wav:<fichier>)." },
+    { Str::CALIBRATE_START,             "Mesure de la latence audio du peripherique actuel (%d passes) ..." },
+    { Str::CALIBRATE_RESULT,            "Ouverture du peripherique : %lld ms | Latence de sortie : %lld ms" },
+    { Str::CALIBRATE_SAVED,             "Valeurs enregistrees dans teefax.ini (--audio-open-ms, --audio-latency-ms)." },
+    { Str::CALIBRATE_SAVE_FAILED,       "Erreur : impossible d'ecrire teefax.ini." },
+    { Str::CALIBRATE_FAILED,            "Erreur : impossible d'ouvrir le peripherique audio." },
+    { Str::ERROR_INVALID_TONE,          "Son inconnu : '%s' (autorises : chime, beep, gong)." },
+    { Str::ERROR_UNSUPPORTED_SOUND,     "Impossible de lire le fichier audio : %s (pris en charge : WAV PCM 8/16/24/32 bits, float ou IMA-ADPCM)." },
+    { Str::ERROR_INVALID_METRONOME,     "Cadence invalide : '%s' (--metronome : BPM jusqu'a 1200, --beep-every : au moins 50ms)." },
+    { Str::ERROR_INVALID_ACCENT,        "Motif d'accentuation invalide : '%s' (autorises : X = accentue, x = normal, . = silence)." },
+    { Str::METRONOME_LABEL,             "Metronome" },
+    { Str::METRONOME_HINT,              "%.1f battements/min, motif %s | Ctrl+C : quitter" },
+    { Str::ERROR_INVALID_OUTPUT,        "Format de sortie invalide : '%s' (autorises : text, jsonl)." },
+    { Str::ERROR_INVALID_OUTPUT_TICK,   "Intervalle de tick invalide : '%s' (minimum 10ms)." },
+    { Str::ERROR_INVALID_BAR,           "Style de barre invalide : '%s' (autorises : classic, smooth)." },
+    { Str::ERROR_INVALID_FPS,           "Frequence d'images invalide : '%s' (1 a %d)." },
+    { Str::TIMER_KEYS_HINT,             "Espace ou P: Pause/Reprendre | +: une minute de plus | S (alarme): rappel 5 min | Echap ou Q: Annuler" },
+    { Str::TIMER_CANCELLED,             "Minuteur annule." },
+    { Str::LAP_LINE,                    "Tour %llu : %s (total %s)" },
+    { Str::LAPS_SKIPPED,                "... %llu tours non affiches (inclus dans l'export)" },
+    { Str::LAPS_SAVED,                  "%llu tours enregistres : %s" },
+    { Str::LAPS_SAVE_FAILED,            "Erreur : impossible d'enregistrer les tours : %s" },
+    { Str::SW_MISSING_NAME,             "Erreur : --sw attend un nom, p. ex. --sw build start" },
+    { Str::SW_INVALID_NAME,             "Erreur : nom de chronometre invalide '%s' (1-31 caracteres : lettres, chiffres, - _ .)" },
+    { Str::SW_INVALID_SUBCMD,           "Erreur : commande de chronometre inconnue '%s' (start, stop, lap, reset, remove, show)" },
+    { Str::SW_STORE_ERROR,              "Erreur : impossible d'ouvrir teefax-stopwatches.dat a cote de teefax.exe." },
+    { Str::SW_STORE_FULL,               "Erreur : pas de place pour le chronometre '%s' (64 au maximum ; liberer avec 'remove')." },
+    { Str::SW_NOT_FOUND,                "Chronometre '%s' introuvable." },
+    { Str::SW_REMOVED,                  "Chronometre '%s' supprime." },
+    { Str::STATUS_HEADER,               "ID       Mode       Etat         Restant    Boucle    Note" },
+    { Str::STATUS_STATE_RUNNING,        "en cours" },
+    { Str::STATUS_STATE_PAUSED,         "en pause" },
+    { Str::STATUS_STATE_ALARM,          "alarme" },
+    { Str::STATUS_NONE,                 "Aucun minuteur en cours." },
+    { Str::ATTACH_MISSING_ID,           "Erreur : --attach attend un ID de --status." },
+    { Str::ATTACH_NOT_FOUND,            "Aucun minuteur en cours avec l'ID '%s' (voir --status)." },
+    { Str::ATTACH_ENDED,                "Minuteur %u termine." },
+    { Str::CONTROL_USAGE,               "Usage : --control <id> pause|resume|cancel|add <duree>|sub <duree>|target <HH:MM[:SS]|duree>" },
+    { Str::CONTROL_SENT,                "Commande '%s' envoyee au minuteur %s." },
+    { Str::CONTROL_FAILED,              "Erreur : commande '%s' refusee par le minuteur %s." },
+    { Str::MACRO_SAVE_FAILED,           "Erreur : impossible d'ecrire teefax.ini." },
+    { Str::MACRO_CYCLE,                 "Erreur : la macro '%s' s'appelle elle-meme (cycle)." },
+    { Str::MACRO_MISSING_PARAMS,        "Erreur : la macro '%s' attend %d argument(s)." },
+    { Str::CONFIG_RELOADED,             "teefax.ini recharge (son, pre-alarme, repetitions, actions)." },
+    { Str::CONFIG_RELOAD_FAILED,        "Avertissement : teefax.ini contient des erreurs, les reglages actuels restent actifs." },
+    { Str::CALIBRATE_NEEDS_DEVICE,      "Erreur : --calibrate-audio ne mesure qu'un vrai peripherique de sortie (pas avec --audio-backend null/wav:)." },
     };
 
 static const TranslationMap LANG_PT = {
@@ -356,16 +526,32 @@ static const TranslationMap LANG_PT = {
         "  -a,  --at YYYY-MM-DD        Contar ate a data indicada\n"
         "  -a,  --at YYYY-MM-DD HH:MM  Data e hora combinadas\n"
         "  -as, --async                Reproduzir som de forma assincrona\n"
+        "       --audio-backend <b>    Saida de audio: winmm (predefinido), null, wav:<ficheiro>\n"
+        "       --tone <name>          Som integrado: chime (predefinido), beep, gong\n"
+        "       --metronome <bpm>      Metronomo (sem tempo: ate Ctrl+C)\n"
+        "       --beep-every <duracao> Bip em intervalo fixo (ex. 30s)\n"
+        "       --accent <padrao>      Acento por batida: X acentuado, x normal, . pausa\n"
+        "       --calibrate-audio      Medir a latencia de audio e guardar em teefax.ini\n"
+        "       --bar <estilo>         Barra: classic (padrao) ou smooth (oitavos de bloco)\n"
+        "       --output <formato>     Saida: text (padrao) ou jsonl (eventos)\n"
+        "       --output-tick <dur>    Intervalo dos ticks jsonl (padrao: 1s)\n"
         "  -s,  --sound <ficheiro>     Som de alarme personalizado\n"
         "  -o,  --open <caminho>       Abrir ficheiro apos o temporizador\n"
         "  -c,  --cmd  <comando>       Executar comando apos o temporizador\n"
         "  -ns, --nosleep              Impedir a suspensao do sistema\n"
         "       --eco                  Modo economizador (recomendado em bateria ou Windows antigo)\n"
+        "       --watch-config         Observar teefax.ini, aplicar alteracoes no proximo ciclo\n"
         "       --nomsg                Sem janela de notificacao\n"
         "       <nota>                 Nota entre aspas (sem nome de opcao)\n"
         "  -pa, --prealarm <s>         Bip por segundo X segundos antes do fim\n"
         "  -t,  --time                 Mostrar data e hora em tempo real\n"
         "  -sw, --stopwatch            Iniciar cronometro (sair com Ctrl+C)\n"
+        "       --fps <n>              Quadros por segundo do cronometro (padrao: 100)\n"
+        "       --laps <arquivo>       Salvar as voltas do cronometro ao sair (.json, senao CSV)\n"
+        "       --sw <nome> <cmd>      Cronometro nomeado: start, stop, lap, reset, remove, show\n"
+        "       --status               Listar temporizadores em execucao (ID, tempo restante, nota)\n"
+        "       --attach <id>          Mostrar ao vivo a barra de um temporizador em execucao\n"
+        "       --control <id> <cmd>   Controlar um temporizador: pause|resume|cancel|add|sub|target\n"
         "  -d,  --daily HH:mm[:ss]     Alarme diario\n"
         "  -e,  --every <dias> [HH:mm] Semanal/mensal (ex. mon,fri ou 1,15)\n"
         "  -f,  --focus <titulo>       Trazer janela para o primeiro plano apos o temporizador\n"
@@ -400,7 +586,7 @@ static const TranslationMap LANG_PT = {
     { Str::OPEN_TARGET,      " | Abre: \"%s\"" },
     { Str::STOPWATCH_LABEL,  "Cronometro" },
     { Str::ELAPSED,          "Decorrido: %s" },
-    { Str::STOPWATCH_HINT,   "Espaco ou P: Pausar/Continuar | R: Reset | Ctrl+C: Sair" },
+    { Str::STOPWATCH_HINT,   "Espaco ou P: Pausar/Continuar | L ou Enter: Volta | R: Reset | E: Salvar voltas | Esc ou Q: Sair" },
     { Str::STOPWATCH_PAUSED, "[PAUSADO]" },
     { Str::MACRO_ADDED,           "Macro '%s' guardado." },
     { Str::MACRO_OVERWRITE_PROMPT,"O macro '%s' ja existe. Substituir? [s/n]: " },
@@ -423,6 +609,52 @@ static const TranslationMap LANG_PT = {
     { Str::WARN_ALARM_REPEAT_TOO_LARGE, "Aviso: valor --alarm-repeat '%s' demasiado grande, usando maximo (%lld)." },
     { Str::WARN_PATH_TOO_LONG,          "Aviso: caminho para teefax.exe demasiado longo (>=%d caracteres). teefax.ini sera ignorado." },
     { Str::WARN_TIMER_PERIOD,           "Aviso: timeBeginPeriod(1) falhou. Precisao de espera ~15ms em vez de ~1ms." },
+    { Str::ERROR_INVALID_AUDIO_BACKEND, "Backend de audio invalido: '%s' (permitidos: winmm, null, wav:<ficheiro>)." },
+    { Str::CALIBRATE_START,             "A medir a latencia de audio do dispositivo atual (%d passagens) ..." },
+    { Str::CALIBRATE_RESULT,            "Abertura do dispositivo: %lld ms | Latencia de saida: %lld ms" },
+    { Str::CALIBRATE_SAVED,             "Valores guardados em teefax.ini (--audio-open-ms, --audio-latency-ms)." },
+    { Str::CALIBRATE_SAVE_FAILED,       "Erro: nao foi possivel escrever teefax.ini." },
+    { Str::CALIBRATE_FAILED,            "Erro: nao foi possivel abrir o dispositivo de audio." },
+    { Str::ERROR_INVALID_TONE,          "Som desconhecido: '%s' (permitidos: chime, beep, gong)." },
+    { Str::ERROR_UNSUPPORTED_SOUND,     "Nao e possivel ler o ficheiro de audio: %s (suportado: WAV PCM 8/16/24/32 bits, float ou IMA-ADPCM)." },
+    { Str::ERROR_INVALID_METRONOME,     "Cadencia invalida: '%s' (--metronome: BPM ate 1200, --beep-every: pelo menos 50ms)." },
+    { Str::ERROR_INVALID_ACCENT,        "Padrao de acentuacao invalido: '%s' (permitidos: X = acentuado, x = normal, . = pausa)." },
+    { Str::METRONOME_LABEL,             "Metronomo" },
+    { Str::METRONOME_HINT,              "%.1f batidas/min, padrao %s | Ctrl+C: sair" },
+    { Str::ERROR_INVALID_OUTPUT,        "Formato de saida invalido: '%s' (permitidos: text, jsonl)." },
+    { Str::ERROR_INVALID_OUTPUT_TICK,   "Intervalo de tick invalido: '%s' (minimo 10ms)." },
+    { Str::ERROR_INVALID_BAR,           "Estilo de barra invalido: '%s' (permitidos: classic, smooth)." },
+    { Str::ERROR_INVALID_FPS,           "Taxa de quadros invalida: '%s' (1 a %d)." },
+    { Str::TIMER_KEYS_HINT,             "Espaco ou P: Pausar/Continuar | +: mais um minuto | S (no alarme): soneca 5 min | Esc ou Q: Cancelar" },
+    { Str::TIMER_CANCELLED,             "Temporizador cancelado." },
+    { Str::LAP_LINE,                    "Volta %llu: %s (total %s)" },
+    { Str::LAPS_SKIPPED,                "... %llu voltas nao exibidas (incluidas na exportacao)" },
+    { Str::LAPS_SAVED,                  "%llu voltas salvas: %s" },
+    { Str::LAPS_SAVE_FAILED,            "Erro: nao foi possivel salvar as voltas: %s" },
+    { Str::SW_MISSING_NAME,             "Erro: --sw espera um nome, p. ex. --sw build start" },
+    { Str::SW_INVALID_NAME,             "Erro: nome de cronometro invalido '%s' (1-31 caracteres: letras, digitos, - _ .)" },
+    { Str::SW_INVALID_SUBCMD,           "Erro: comando de cronometro desconhecido '%s' (start, stop, lap, reset, remove, show)" },
+    { Str::SW_STORE_ERROR,              "Erro: nao foi possivel abrir teefax-stopwatches.dat junto a teefax.exe." },
+    { Str::SW_STORE_FULL,               "Erro: sem espaco para o cronometro '%s' (no maximo 64; liberar com 'remove')." },
+    { Str::SW_NOT_FOUND,                "Cronometro '%s' nao encontrado." },
+    { Str::SW_REMOVED,                  "Cronometro '%s' removido." },
+    { Str::STATUS_HEADER,               "ID       Modo       Estado       Restante   Ciclo     Nota" },
+    { Str::STATUS_STATE_RUNNING,        "em curso" },
+    { Str::STATUS_STATE_PAUSED,         "pausado" },
+    { Str::STATUS_STATE_ALARM,          "alarme" },
+    { Str::STATUS_NONE,                 "Nenhum temporizador em execucao." },
+    { Str::ATTACH_MISSING_ID,           "Erro: --attach espera um ID de --status." },
+    { Str::ATTACH_NOT_FOUND,            "Nenhum temporizador em execucao com ID '%s' (ver --status)." },
+    { Str::ATTACH_ENDED,                "Temporizador %u terminado." },
+    { Str::CONTROL_USAGE,               "Uso: --control <id> pause|resume|cancel|add <duracao>|sub <duracao>|target <HH:MM[:SS]|duracao>" },
+    { Str::CONTROL_SENT,                "Comando '%s' enviado ao temporizador %s." },
+    { Str::CONTROL_FAILED,              "Erro: comando '%s' recusado pelo temporizador %s." },
+    { Str::MACRO_SAVE_FAILED,           "Erro: nao foi possivel gravar teefax.ini." },
+    { Str::MACRO_CYCLE,                 "Erro: a macro '%s' chama a si mesma (ciclo)." },
+    { Str::MACRO_MISSING_PARAMS,        "Erro: a macro '%s' espera %d argumento(s)." },
+    { Str::CONFIG_RELOADED,             "teefax.ini recarregado (som, pre-alarme, repeticoes, acoes)." },
+    { Str::CONFIG_RELOAD_FAILED,        "Aviso: teefax.ini contem erros, as configuracoes atuais continuam ativas." },
+    { Str::CALIBRATE_NEEDS_DEVICE,      "Erro: --calibrate-audio so mede um dispositivo de saida real (nao com --audio-backend null/wav:)." },
     };
 
 static const TranslationMap LANG_RU = {
@@ -474,16 +706,32 @@ static const TranslationMap LANG_RU = {
         "  -a,  --at YYYY-MM-DD        Otschet do ukazannoj daty\n"
         "  -a,  --at YYYY-MM-DD HH:MM  Data i vremya vmeste\n"
         "  -as, --async                Vosproizvodit' zvuk asinkronno\n"
+        "       --audio-backend <b>    Audiovyvod: winmm (po umolchaniyu), null, wav:<fayl>\n"
+        "       --tone <name>          Vstroennyy zvuk: chime (po umolchaniyu), beep, gong\n"
+        "       --metronome <bpm>      Metronom (bez vremeni: do Ctrl+C)\n"
+        "       --beep-every <dlit>    Signal s fiksirovannym intervalom (napr. 30s)\n"
+        "       --accent <shablon>     Akcent na dolyu: X akcent, x obychnyy, . pauza\n"
+        "       --calibrate-audio      Izmerit' audiozaderzhku i sokhranit' v teefax.ini\n"
+        "       --bar <stil>           Polosa: classic (po umolchaniyu) ili smooth (1/8 bloki)\n"
+        "       --output <format>      Vyvod: text (po umolchaniyu) ili jsonl (sobytiya)\n"
+        "       --output-tick <dlit>   Interval tikov jsonl (po umolchaniyu: 1s)\n"
         "  -s,  --sound <fajl>         Sobstvennyj zvuk signala\n"
         "  -o,  --open <put'>          Otkryt' fajl posle tajmera\n"
         "  -c,  --cmd  <komanda>       Vypolnit' komandu posle tajmera\n"
         "  -ns, --nosleep              Zapretit' son sistemy\n"
         "       --eco                  Rezhim ekonomii (rekomendovan pri rabote na bataree ili starom Windows)\n"
+        "       --watch-config         Sledit' za teefax.ini, primenyat' izmeneniya so sleduyushchego cikla\n"
         "       --nomsg                Bez okna uvedomleniya\n"
         "       <zametka>              Zametka v kavychkakh (bez imeni optsii)\n"
         "  -pa, --prealarm <s>         Bip kazhduyu sekundu za X sekund do kontsa\n"
         "  -t,  --time                 Pokazyvat' tekushchee vremya\n"
         "  -sw, --stopwatch            Zapustit' sekundomer (vyjti Ctrl+C)\n"
+        "       --fps <n>              Kadrov v sekundu sekundomera (po umolchaniyu: 100)\n"
+        "       --laps <fajl>          Sokhranit' krugi sekundomera pri vykhode (.json, inache CSV)\n"
+        "       --sw <imya> <kmd>      Imenovannyj sekundomer: start, stop, lap, reset, remove, show\n"
+        "       --status               Spisok zapushchennykh tajmerov (ID, ostatok, zametka)\n"
+        "       --attach <id>          Pokazyvat' polosu zapushchennogo tajmera\n"
+        "       --control <id> <cmd>   Upravlyat' tajmerom: pause|resume|cancel|add|sub|target\n"
         "  -d,  --daily HH:mm[:ss]     Ezhednevnyj signal\n"
         "  -e,  --every <dni> [HH:mm]  Ezhenedel'no/ezhemesyachno (napr. mon,fri ili 1,15)\n"
         "  -f,  --focus <zagolovok>    Vyvestu okno na peredni plan posle tajmera\n"
@@ -518,7 +766,7 @@ static const TranslationMap LANG_RU = {
     { Str::OPEN_TARGET,      " | Otkryvaet: \"%s\"" },
     { Str::STOPWATCH_LABEL,  "Sekundomer" },
     { Str::ELAPSED,          "Proshlo: %s" },
-    { Str::STOPWATCH_HINT,   "Probel ili P: Pauza/Prodolzhit' | R: Reset | Ctrl+C: Vyjti" },
+    { Str::STOPWATCH_HINT,   "Probel ili P: Pauza/Prodolzhit' | L ili Enter: Krug | R: Reset | E: Sokhranit' krugi | Esc ili Q: Vyjti" },
     { Str::STOPWATCH_PAUSED, "[PAUZA]" },
     { Str::MACRO_ADDED,           "Makros '%s' sokhranyon." },
     { Str::MACRO_OVERWRITE_PROMPT,"Makros '%s' uzhe sushchestvuet. Perezapisat'? [d/n]: " },
@@ -541,6 +789,52 @@ static const TranslationMap LANG_RU = {
     { Str::WARN_ALARM_REPEAT_TOO_LARGE, "Preduprezhdenie: znachenie --alarm-repeat '%s' slishkom veliko, ispol'zuyu maksimum (%lld)." },
     { Str::WARN_PATH_TOO_LONG,          "Preduprezhdenie: put' k teefax.exe slishkom dlinnyj (>=%d simvolov). teefax.ini budet ignorirovan." },
     { Str::WARN_TIMER_PERIOD,           "Preduprezhdenie: timeBeginPeriod(1) ne udalsya. Tochnost' sna ~15ms vmesto ~1ms." },
+    { Str::ERROR_INVALID_AUDIO_BACKEND, "Nevernyy audio-bekend: '%s' (dopustimo: winmm, null, wav:<fayl>)." },
+    { Str::CALIBRATE_START,             "Izmerenie audiozaderzhki tekushchego ustroystva (%d progonov) ..." },
+    { Str::CALIBRATE_RESULT,            "Otkrytie ustroystva: %lld ms | Zaderzhka vyvoda: %lld ms" },
+    { Str::CALIBRATE_SAVED,             "Znacheniya sokhraneny v teefax.ini (--audio-open-ms, --audio-latency-ms)." },
+    { Str::CALIBRATE_SAVE_FAILED,       "Oshibka: ne udalos' zapisat' teefax.ini." },
+    { Str::CALIBRATE_FAILED,            "Oshibka: ne udalos' otkryt' audioustroystvo." },
+    { Str::ERROR_INVALID_TONE,          "Neizvestnyy zvuk: '%s' (dopustimo: chime, beep, gong)." },
+    { Str::ERROR_UNSUPPORTED_SOUND,     "Ne udalos prochitat audiofayl: %s (podderzhivaetsya: WAV PCM 8/16/24/32 bit, float ili IMA-ADPCM)." },
+    { Str::ERROR_INVALID_METRONOME,     "Nevernyy takt: '%s' (--metronome: BPM do 1200, --beep-every: ne menee 50ms)." },
+    { Str::ERROR_INVALID_ACCENT,        "Nevernyy shablon akcentov: '%s' (dopustimo: X = akcent, x = obychnyy, . = pauza)." },
+    { Str::METRONOME_LABEL,             "Metronom" },
+    { Str::METRONOME_HINT,              "%.1f udarov/min, shablon %s | Ctrl+C: vyhod" },
+    { Str::ERROR_INVALID_OUTPUT,        "Nevernyy format vyvoda: '%s' (dopustimo: text, jsonl)." },
+    { Str::ERROR_INVALID_OUTPUT_TICK,   "Nevernyy interval tikov: '%s' (minimum 10ms)." },
+    { Str::ERROR_INVALID_BAR,           "Nevernyy stil polosy: '%s' (dopustimo: classic, smooth)." },
+    { Str::ERROR_INVALID_FPS,           "Nevernaya chastota kadrov: '%s' (ot 1 do %d)." },
+    { Str::TIMER_KEYS_HINT,             "Probel ili P: Pauza/Prodolzhit' | +: eshche minuta | S (pri signale): otlozhit' na 5 min | Esc ili Q: Otmena" },
+    { Str::TIMER_CANCELLED,             "Tajmer otmenen." },
+    { Str::LAP_LINE,                    "Krug %llu: %s (vsego %s)" },
+    { Str::LAPS_SKIPPED,                "... %llu krugov ne pokazano (est' v eksporte)" },
+    { Str::LAPS_SAVED,                  "Sokhraneno krugov: %llu: %s" },
+    { Str::LAPS_SAVE_FAILED,            "Oshibka: ne udalos' sokhranit' krugi: %s" },
+    { Str::SW_MISSING_NAME,             "Oshibka: --sw ozhidaet imya, naprimer --sw build start" },
+    { Str::SW_INVALID_NAME,             "Oshibka: nedopustimoe imya sekundomera '%s' (1-31 simvol: bukvy, cifry, - _ .)" },
+    { Str::SW_INVALID_SUBCMD,           "Oshibka: neizvestnaya komanda sekundomera '%s' (start, stop, lap, reset, remove, show)" },
+    { Str::SW_STORE_ERROR,              "Oshibka: ne udalos' otkryt' teefax-stopwatches.dat ryadom s teefax.exe." },
+    { Str::SW_STORE_FULL,               "Oshibka: net mesta dlya sekundomera '%s' (ne bolee 64; osvobodite cherez 'remove')." },
+    { Str::SW_NOT_FOUND,                "Sekundomer '%s' ne najden." },
+    { Str::SW_REMOVED,                  "Sekundomer '%s' udalen." },
+    { Str::STATUS_HEADER,               "ID       Rezhim     Sostoyanie   Ostalos'   Cikl      Zametka" },
+    { Str::STATUS_STATE_RUNNING,        "idet" },
+    { Str::STATUS_STATE_PAUSED,         "pauza" },
+    { Str::STATUS_STATE_ALARM,          "signal" },
+    { Str::STATUS_NONE,                 "Net zapushchennykh tajmerov." },
+    { Str::ATTACH_MISSING_ID,           "Oshibka: --attach ozhidaet ID iz --status." },
+    { Str::ATTACH_NOT_FOUND,            "Net zapushchennogo tajmera s ID '%s' (sm. --status)." },
+    { Str::ATTACH_ENDED,                "Tajmer %u zavershen." },
+    { Str::CONTROL_USAGE,               "Ispol'zovanie: --control <id> pause|resume|cancel|add <dlit.>|sub <dlit.>|target <HH:MM[:SS]|dlit.>" },
+    { Str::CONTROL_SENT,                "Komanda '%s' otpravlena tajmeru %s." },
+    { Str::CONTROL_FAILED,              "Oshibka: komanda '%s' ne prinyata tajmerom %s." },
+    { Str::MACRO_SAVE_FAILED,           "Oshibka: ne udalos' zapisat' teefax.ini." },
+    { Str::MACRO_CYCLE,                 "Oshibka: makros '%s' vyzyvaet sam sebya (cikl)." },
+    { Str::MACRO_MISSING_PARAMS,        "Oshibka: makros '%s' ozhidaet %d argument(ov)." },
+    { Str::CONFIG_RELOADED,             "teefax.ini perezagruzhen (zvuk, predvaritel'nyj signal, povtory, dejstviya)." },
+    { Str::CONFIG_RELOAD_FAILED,        "Preduprezhdenie: v teefax.ini oshibki, tekushchie nastrojki sokhraneny." },
+    { Str::CALIBRATE_NEEDS_DEVICE,      "Oshibka: --calibrate-audio izmeryaet tol'ko real'noe ustrojstvo vyvoda (ne s --audio-backend null/wav:)." },
     };
 
 static const TranslationMap LANG_EN = {
@@ -592,16 +886,32 @@ static const TranslationMap LANG_EN = {
         "  -a,  --at YYYY-MM-DD        Count to specified date\n"
         "  -a,  --at YYYY-MM-DD HH:MM  Date and time combined\n"
         "  -as, --async                Play sound asynchronously\n"
+        "       --audio-backend <b>    Audio output: winmm (default), null, wav:<file>\n"
+        "       --tone <name>          Built-in alarm tone: chime (default), beep, gong\n"
+        "       --metronome <bpm>      Metronome (without a time: until Ctrl+C)\n"
+        "       --beep-every <dur>     Beep at a fixed interval (e.g. 30s)\n"
+        "       --accent <pattern>     Accent per beat: X accented, x normal, . rest\n"
+        "       --calibrate-audio      Measure audio latency and save it to teefax.ini\n"
+        "       --bar <style>          Bar: classic (default) or smooth (eighth blocks)\n"
+        "       --output <format>      Output: text (default) or jsonl (events)\n"
+        "       --output-tick <dur>    Interval of jsonl tick events (default: 1s)\n"
         "  -s,  --sound <file>         Custom alarm sound\n"
         "  -o,  --open <filepath>      Open file after timer\n"
         "  -c,  --cmd  <command>       Run console command after timer\n"
         "  -ns, --nosleep              Suppress screensaver\n"
         "       --eco                  Power-saving mode (recommended on battery or older Windows)\n"
+        "       --watch-config         Watch teefax.ini and apply changes from the next round on\n"
         "       --nomsg                No notification popup\n"
         "       <note>                 Custom note, in quotes (no option name)\n"
         "  -pa, --prealarm <s>         Beep every second X seconds before end\n"
         "  -t,  --time                 Live date & time display\n"
         "  -sw, --stopwatch            Start stopwatch (exit with Ctrl+C)\n"
+        "       --fps <n>              Stopwatch frames per second (default: 100)\n"
+        "       --laps <file>          Save stopwatch laps on exit (.json, otherwise CSV)\n"
+        "       --sw <name> <cmd>      Named stopwatch: start, stop, lap, reset, remove, show\n"
+        "       --status               List running timers (ID, remaining time, note)\n"
+        "       --attach <id>          Show a running timer's progress bar live\n"
+        "       --control <id> <cmd>   Control a running timer: pause|resume|cancel|add|sub|target\n"
         "  -d,  --daily HH:mm[:ss]     Daily alarm\n"
         "  -e,  --every <days> [HH:mm] Weekly/monthly recurrence (e.g. mon,fri or 1,15)\n"
         "  -f,  --focus <title>        Bring window to foreground after timer\n"
@@ -636,7 +946,7 @@ static const TranslationMap LANG_EN = {
     { Str::OPEN_TARGET,      " | Opens: \"%s\"" },
     { Str::STOPWATCH_LABEL,  "Stopwatch" },
     { Str::ELAPSED,          "Elapsed: %s" },
-    { Str::STOPWATCH_HINT,   "Space or P: Pause/Resume | R: Reset | Ctrl+C: Exit" },
+    { Str::STOPWATCH_HINT,   "Space or P: Pause/Resume | L or Enter: Lap | R: Reset | E: Save laps | Esc or Q: Exit" },
     { Str::STOPWATCH_PAUSED, "[PAUSED]" },
     { Str::MACRO_ADDED,           "Macro '%s' saved." },
     { Str::MACRO_OVERWRITE_PROMPT,"Macro '%s' already exists. Overwrite? [y/n]: " },
@@ -659,6 +969,52 @@ static const TranslationMap LANG_EN = {
     { Str::WARN_ALARM_REPEAT_TOO_LARGE, "Warning: --alarm-repeat value '%s' is too large, using maximum (%lld)." },
     { Str::WARN_PATH_TOO_LONG,          "Warning: path to teefax.exe is too long (>=%d chars). teefax.ini will be ignored." },
     { Str::WARN_TIMER_PERIOD,           "Warning: timeBeginPeriod(1) failed. Sleep precision may be ~15ms instead of ~1ms." },
+    { Str::ERROR_INVALID_AUDIO_BACKEND, "Invalid audio backend: '%s' (allowed: winmm, null, wav:<file>)." },
+    { Str::CALIBRATE_START,             "Measuring audio latency of the current output device (%d runs) ..." },
+    { Str::CALIBRATE_RESULT,            "Device open: %lld ms | Output latency: %lld ms" },
+    { Str::CALIBRATE_SAVED,             "Values saved to teefax.ini (--audio-open-ms, --audio-latency-ms)." },
+    { Str::CALIBRATE_SAVE_FAILED,       "Error: could not write teefax.ini." },
+    { Str::CALIBRATE_FAILED,            "Error: could not open the audio device." },
+    { Str::ERROR_INVALID_TONE,          "Unknown tone: '%s' (allowed: chime, beep, gong)." },
+    { Str::ERROR_UNSUPPORTED_SOUND,     "Cannot read audio file: %s (supported: WAV with 8/16/24/32-bit PCM, float or IMA ADPCM)." },
+    { Str::ERROR_INVALID_METRONOME,     "Invalid rate: '%s' (--metronome: BPM up to 1200, --beep-every: at least 50ms)." },
+    { Str::ERROR_INVALID_ACCENT,        "Invalid accent pattern: '%s' (allowed: X = accented, x = normal, . = rest)." },
+    { Str::METRONOME_LABEL,             "Metronome" },
+    { Str::METRONOME_HINT,              "%.1f beats/min, pattern %s | Ctrl+C: quit" },
+    { Str::ERROR_INVALID_OUTPUT,        "Invalid output format: '%s' (allowed: text, jsonl)." },
+    { Str::ERROR_INVALID_OUTPUT_TICK,   "Invalid tick interval: '%s' (at least 10ms)." },
+    { Str::ERROR_INVALID_BAR,           "Invalid bar style: '%s' (allowed: classic, smooth)." },
+    { Str::ERROR_INVALID_FPS,           "Invalid frame rate: '%s' (1 to %d)." },
+    { Str::TIMER_KEYS_HINT,             "Space or P: Pause/Resume | +: one more minute | S (during alarm): snooze 5 min | Esc or Q: Cancel" },
+    { Str::TIMER_CANCELLED,             "Timer cancelled." },
+    { Str::LAP_LINE,                    "Lap %llu: %s (total %s)" },
+    { Str::LAPS_SKIPPED,                "... %llu laps not shown (included in the export)" },
+    { Str::LAPS_SAVED,                  "%llu laps saved: %s" },
+    { Str::LAPS_SAVE_FAILED,            "Error: could not save laps: %s" },
+    { Str::SW_MISSING_NAME,             "Error: --sw expects a name, e.g. --sw build start" },
+    { Str::SW_INVALID_NAME,             "Error: invalid stopwatch name '%s' (1-31 characters: letters, digits, - _ .)" },
+    { Str::SW_INVALID_SUBCMD,           "Error: unknown stopwatch command '%s' (start, stop, lap, reset, remove, show)" },
+    { Str::SW_STORE_ERROR,              "Error: cannot open teefax-stopwatches.dat next to teefax.exe." },
+    { Str::SW_STORE_FULL,               "Error: no room for stopwatch '%s' (at most 64; free one with 'remove')." },
+    { Str::SW_NOT_FOUND,                "Stopwatch '%s' not found." },
+    { Str::SW_REMOVED,                  "Stopwatch '%s' removed." },
+    { Str::STATUS_HEADER,               "ID       Mode       State        Remaining  Loop      Note" },
+    { Str::STATUS_STATE_RUNNING,        "running" },
+    { Str::STATUS_STATE_PAUSED,         "paused" },
+    { Str::STATUS_STATE_ALARM,          "alarm" },
+    { Str::STATUS_NONE,                 "No running timers." },
+    { Str::ATTACH_MISSING_ID,           "Error: --attach expects an ID from --status." },
+    { Str::ATTACH_NOT_FOUND,            "No running timer with ID '%s' (see --status)." },
+    { Str::ATTACH_ENDED,                "Timer %u finished." },
+    { Str::CONTROL_USAGE,               "Usage: --control <id> pause|resume|cancel|add <duration>|sub <duration>|target <HH:MM[:SS]|duration>" },
+    { Str::CONTROL_SENT,                "Command '%s' sent to timer %s." },
+    { Str::CONTROL_FAILED,              "Error: command '%s' was rejected by timer %s." },
+    { Str::MACRO_SAVE_FAILED,           "Error: could not write teefax.ini." },
+    { Str::MACRO_CYCLE,                 "Error: macro '%s' calls itself (cycle)." },
+    { Str::MACRO_MISSING_PARAMS,        "Error: macro '%s' expects %d argument(s)." },
+    { Str::CONFIG_RELOADED,             "teefax.ini reloaded (sound, pre-alarm, repeats, actions)." },
+    { Str::CONFIG_RELOAD_FAILED,        "Warning: teefax.ini contains errors; the current settings stay active." },
+    { Str::CALIBRATE_NEEDS_DEVICE,      "Error: --calibrate-audio only measures a real output device (not with --audio-backend null/wav:)." },
     };
 
 // ── Spracherkennung ───────────────────────────────────────────────────
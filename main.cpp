@@ -21,12 +21,20 @@
 #include <limits>
 #include <cctype>
 #include <atomic>
-#include "sound_array.h" // Signalton
 #include <vector> // Für täglichen Alarm
 #include <sstream> // Für --every Parsing/Formatierung
 #include <conio.h> // _kbhit(), _getch() für Stoppuhr-Pause
 #include <algorithm>
 #include <optional>
+#include <mutex>              // Audio-Mixer: Quittungen, Klang-Cache
+#include <condition_variable> // Audio-Mixer: synchrone Wiedergabe
+#include <memory>
+#include <charconv>           // to_chars: allokationsfreie Zahlenformatierung
+#include <string_view>        // teefax.ini-Modell: Zeilen und Makros ohne Kopien
+#include <unordered_set>      // Makro-Expansion: Zykluserkennung
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>        // SSE2 fuer das Mischen
+#endif
 
 
 
@@ -41,6 +49,28 @@ static atomic<bool> g_timePeriodSet{false};
 static DWORD g_originalConsoleMode = 0;
 static bool  g_consoleModeChanged  = false;
 
+// --output jsonl: stdout gehört dem Ereignisstrom, Meldungen weichen auf stderr aus
+static bool g_jsonOutput = false;
+static ostream& textOut() { return g_jsonOutput ? cerr : cout; }
+static void emitInterruptedEvent(); // Ereignisstrom, siehe runTimerLoop()
+
+// --laps: Stoppuhr-Runden auch bei Strg+C noch exportieren
+static atomic<bool> g_lapsExport{false};
+static void exportLapsOnInterrupt(); // siehe LapRecorder
+
+#ifdef TEEFAX_COUNT_ALLOCS
+// Prüf-Build (qmake CONFIG+=alloccheck): zählt alle Heap-Allokationen, damit
+// runTimerLoop() nachweisen kann, dass der eingeschwungene Tick nichts allokiert.
+static atomic<unsigned long long> g_allocCount{0};
+void* operator new(size_t n) {
+    g_allocCount.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(n ? n : 1)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+#endif
+
 // Maximale Millisekunden (wir nutzen die maximale long long, etwas konservativ geclamped)
 constexpr long long MAX_MS = std::numeric_limits<long long>::max() / 4;
 
@@ -54,6 +84,8 @@ constexpr long long WALL_SAFE_MS = 3'153'600'000'000LL; // 100 * 365 * 86400 * 1
 
 // Ctrl-C / Console Event Handler: versucht, timeEndPeriod zurückzusetzen
 BOOL WINAPI ConsoleHandler(DWORD /*signal*/) {
+    if (g_jsonOutput) emitInterruptedEvent();
+    if (g_lapsExport.load()) exportLapsOnInterrupt();
     if (g_timePeriodSet.load()) {
         timeEndPeriod(1);
         g_timePeriodSet.store(false);
@@ -299,12 +331,9 @@ inline wstring toWideArgv(const string& str) {
     return toWide(str, CP_ACP);
 }
 
-// Rueckkonvertierung fuer die Konsolenausgabe: wstring -> string in der aktuellen
-// Konsolenausgabe-Codepage (GetConsoleOutputCP), damit Umlaute korrekt erscheinen.
-// CP_ACP (Eingabe) != GetConsoleOutputCP() (Ausgabe, z.B. CP_850 auf deutschen Systemen).
-string toConsole(const wstring& wstr) {
+// Rueckkonvertierung: wstring -> string in der angegebenen Codepage.
+string fromWide(const wstring& wstr, UINT cp) {
     if (wstr.empty()) return string();
-    UINT cp = GetConsoleOutputCP();
     int size = WideCharToMultiByte(cp, 0, wstr.c_str(), -1, NULL, 0, NULL, NULL);
     if (size == 0) return string();
     string str(size, '\0');
@@ -313,6 +342,13 @@ string toConsole(const wstring& wstr) {
     return str;
 }
 
+// Fuer die Konsolenausgabe: aktuelle Konsolenausgabe-Codepage (GetConsoleOutputCP),
+// damit Umlaute korrekt erscheinen. CP_ACP (Eingabe) != GetConsoleOutputCP()
+// (Ausgabe, z.B. CP_850 auf deutschen Systemen).
+string toConsole(const wstring& wstr) {
+    return fromWide(wstr, GetConsoleOutputCP());
+}
+
 // ── Julianische Tageszahl und mktime-freie Zeitdifferenz ─────────────
 
 // Gregorianisches Datum → Julianische Tageszahl nach Richards (2013).
@@ -466,7 +502,8 @@ bool openFileAfterTimer(const string& filePath) {
     // Balkenreste, die laenger als die Fehlermeldung sind.
     auto printErr = [](const char* buf) {
         const char* msg = (buf[0] == '\n') ? buf + 1 : buf;
-        cout << "\r" << msg << "                                        " << flush;
+        if (g_jsonOutput) textOut() << msg << "\n" << flush; // Ergebnis steht im Ereignis
+        else cout << "\r" << msg << "                                        " << flush;
     };
 
     bool isUrl = filePath.rfind("http://", 0) == 0 ||
@@ -514,10 +551,11 @@ bool openFileAfterTimer(const string& filePath) {
 // beginnt. Verhindert Zeileninterleaving und doppelte Durchlauf-Anzeigen.
 // Hinweis: Langlaeufer (z. B. "notepad.exe" ohne "start") blockieren teefax
 // bis zum Beenden des Programms. Fuer solche Faelle "start" vorschalten.
-void runConsoleCommand(const string& command) {
+// Rückgabe: Exitcode des Befehls; -1, wenn er nicht gestartet werden konnte.
+int runConsoleCommand(const string& command) {
     if (command.empty()) {
-        cout << "\n" << t(Str::NO_COMMAND) << "\n";
-        return;
+        textOut() << "\n" << t(Str::NO_COMMAND) << "\n";
+        return -1;
     }
 
     wstring wcommand = toWideArgv(command);
@@ -525,8 +563,8 @@ void runConsoleCommand(const string& command) {
         char buf[512];
         snprintf(buf, sizeof(buf), t(Str::ERROR_CMD_CONVERSION),
                  toConsole(toWideArgv(command)).c_str());
-        cout << "\n" << buf << "\n";
-        return;
+        textOut() << "\n" << buf << "\n";
+        return -1;
     }
 
     string display = toConsole(wcommand);
@@ -535,12 +573,19 @@ void runConsoleCommand(const string& command) {
     {
         char buf[512];
         snprintf(buf, sizeof(buf), t(Str::CMD_STARTED), display.c_str());
-        cout << buf << "\n" << flush;
+        textOut() << buf << "\n" << flush;
     }
 
     STARTUPINFOW si{};
     PROCESS_INFORMATION pi{};
     si.cb = sizeof(si);
+    if (g_jsonOutput) {
+        // Ausgabe des Kindprozesses nach stderr: stdout bleibt reines JSON
+        si.dwFlags    = STARTF_USESTDHANDLES;
+        si.hStdInput  = GetStdHandle(STD_INPUT_HANDLE);
+        si.hStdOutput = GetStdHandle(STD_ERROR_HANDLE);
+        si.hStdError  = GetStdHandle(STD_ERROR_HANDLE);
+    }
 
     wstring fullCmd = L"cmd.exe /C " + wcommand;
 
@@ -554,8 +599,8 @@ void runConsoleCommand(const string& command) {
         DWORD err = GetLastError();
         char buf[512];
         snprintf(buf, sizeof(buf), t(Str::CMD_ERROR), (int)err, display.c_str());
-        cout << buf << "\n";
-        return;
+        textOut() << buf << "\n";
+        return -1;
     }
 
     // QuickEdit sofort nach Prozessstart im Elternprozess neu deaktivieren.
@@ -580,8 +625,11 @@ void runConsoleCommand(const string& command) {
     // Warten bis Prozess beendet: verhindert Ausgabe-Interleaving mit dem
     // naechsten Balken. Langlaeufer blockieren teefax, ggf. "start" nutzen.
     WaitForSingleObject(pi.hProcess, INFINITE);
+    DWORD exitCode = 0;
+    GetExitCodeProcess(pi.hProcess, &exitCode);
     CloseHandle(pi.hProcess);
     CloseHandle(pi.hThread);
+    return static_cast<int>(exitCode);
 }
 
 // Fenster anhand eines Teilstrings im Titel in den Vordergrund holen
@@ -713,8 +761,43 @@ static void applyPowerThrottlingExemption() {
 }
 
 
+// Schreibt "1y 2mo 3d 4h 5m 6s" vom ersten bis zum letzten Nicht-Null-Anteil nach 'buf'
+// (Reihenfolge: Jahre, Monate, Tage, Stunden, Minuten, Sekunden). Ohne Heap-Zugriff,
+// damit die Tick-Schleife im eingeschwungenen Zustand nichts allokiert.
+// Rückgabe: Länge ohne Nullterminator.
+static int formatDurationParts(char* buf, size_t cap, const long long (&vals)[6]) {
+    static const char* const UNITS[6] = { "y", "mo", "d", "h", "m", "s" };
+    // Letzten Nicht-Null-Wert finden
+    int last = -1;
+    for (int i = 5; i >= 0; --i) {
+        if (vals[i] > 0) { last = i; break; }
+    }
+    char* p   = buf;
+    char* end = buf + cap - 1;
+    if (last == -1) {
+        if (cap >= 3) { memcpy(p, "0s", 2); p += 2; }
+        *p = '\0';
+        return static_cast<int>(p - buf);
+    }
+
+    // Ausgabe vom ersten Nicht-Null bis zum letzten Nicht-Null
+    bool found = false;
+    for (int i = 0; i <= last; ++i) {
+        if (vals[i] > 0 || found) {
+            if (found && p < end) *p++ = ' ';
+            auto res = to_chars(p, end, vals[i]);
+            if (res.ec != errc()) break;
+            p = res.ptr;
+            for (const char* u = UNITS[i]; *u && p < end; ++u) *p++ = *u;
+            found = true;
+        }
+    }
+    *p = '\0';
+    return static_cast<int>(p - buf);
+}
+
 // Hilfsfunktion: Sekunden in Jahre/Monate/Tage/Stunden/Minuten/Sekunden aufteilen
-string formatVerbleibend(long long totalSec) {
+static int formatVerbleibendTo(char* buf, size_t cap, long long totalSec) {
     constexpr int secPerMin  = 60;
     constexpr int secPerHour = 60 * secPerMin;
     constexpr int secPerDay  = 24 * secPerHour;
@@ -728,31 +811,14 @@ string formatVerbleibend(long long totalSec) {
     long long minutes = totalSec / secPerMin; totalSec %= secPerMin;
     long long seconds = totalSec;
 
-    struct UnitVal { long long val; const char* unit; };
-    UnitVal parts[] = {
-        {years, "y"}, {months, "mo"}, {days, "d"},
-        {hours, "h"}, {minutes, "m"}, {seconds, "s"}
-    };
-
-    // Letzten Nicht-Null-Wert finden
-    int last = -1;
-    for (int i = 5; i >= 0; --i) {
-        if (parts[i].val > 0) { last = i; break; }
-    }
-    if (last == -1) return "0s";
-
-    // Ausgabe vom ersten Nicht-Null bis zum letzten Nicht-Null
-    stringstream ss;
-    bool found = false;
-    for (int i = 0; i <= last; ++i) {
-        if (parts[i].val > 0 || found) {
-            if (found) ss << " ";
-            ss << parts[i].val << parts[i].unit;
-            found = true;
-        }
-    }
+    const long long vals[6] = { years, months, days, hours, minutes, seconds };
+    return formatDurationParts(buf, cap, vals);
+}
 
-    return ss.str();
+string formatVerbleibend(long long totalSec) {
+    char buf[64];
+    int  n = formatVerbleibendTo(buf, sizeof(buf), totalSec);
+    return string(buf, static_cast<size_t>(n));
 }
 
 // Wie formatVerbleibend(), jedoch fuer weit-zukuenftige --at-Ziele (jenseits WALL_SAFE_MS):
@@ -761,13 +827,13 @@ string formatVerbleibend(long long totalSec) {
 // bei MAX_MS gedeckelte Zaehlung zu gehen. So zeigt die laufende Anzeige die tatsaechliche
 // Entfernung zum Ziel, nicht einen kuenstlich gekappten Ersatzwert. Dieselbe 365-Tage-Jahr-
 // und 30-Tage-Monat-Konvention wie formatVerbleibend(), zwecks einheitlicher Anzeige.
-string formatVerbleibendFar(long long year, int month, int day,
-                            int hour, int minute, int second) {
+static int formatVerbleibendFarTo(char* buf, size_t cap, long long year, int month, int day,
+                                  int hour, int minute, int second) {
     using namespace chrono;
     auto   now  = system_clock::now();
     time_t tnow = system_clock::to_time_t(now);
     tm     local{};
-    if (localtime_s(&local, &tnow) != 0) return "?";
+    if (localtime_s(&local, &tnow) != 0) return snprintf(buf, cap, "?");
 
     long long jdnNow    = toJulianDayNumber(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
     long long jdnTarget = toJulianDayNumber(year, month, day);
@@ -788,29 +854,11 @@ string formatVerbleibendFar(long long year, int month, int day,
     long long minutes = secDiff / 60LL;   secDiff %= 60LL;
     long long seconds = secDiff;
 
-    struct UnitVal { long long val; const char* unit; };
-    UnitVal parts[] = {
-        {years, "y"}, {months, "mo"}, {days, "d"},
-        {hours, "h"}, {minutes, "m"}, {seconds, "s"}
-    };
-    int last = -1;
-    for (int i = 5; i >= 0; --i) {
-        if (parts[i].val > 0) { last = i; break; }
-    }
-    if (last == -1) return "0s";
-
-    stringstream ss;
-    bool found = false;
-    for (int i = 0; i <= last; ++i) {
-        if (parts[i].val > 0 || found) {
-            if (found) ss << " ";
-            ss << parts[i].val << parts[i].unit;
-            found = true;
-        }
-    }
-    return ss.str();
+    const long long vals[6] = { years, months, days, hours, minutes, seconds };
+    return formatDurationParts(buf, cap, vals);
 }
 
+
 // Ja, das sagt dir halt, ob die Zielzeit (--at) auf den morgigen Tag fällt.
 bool isTargetTomorrow(time_t targetT) {
     // localtime_s scheitert auf Windows für time_t-Werte jenseits ~Jahr 3001.
@@ -993,7 +1041,7 @@ chrono::system_clock::time_point nextEveryTarget(const EverySpec& spec) {
 // ── Konfigurationsdatei (CLI-Format) ─────────────────────────────────
 // Tokenisiert eine Konfigurationszeile, respektiert einfache und doppelte
 // Anführungszeichen und bricht bei '#' ab (Kommentar).
-static vector<string> tokenizeConfigLine(const string& line) {
+static vector<string> tokenizeConfigLine(string_view line) {
     vector<string> tokens;
     string cur;
     bool inQuote = false;
@@ -1017,103 +1065,513 @@ static vector<string> tokenizeConfigLine(const string& line) {
     return tokens;
 }
 
-// Liest teefax.ini aus demselben Verzeichnis wie die .exe und hängt
-// alle geparsten Tokens an 'out' an. Fehlt die Datei, passiert nichts.
-static void loadConfigArgs(vector<string>& out) {
-    wchar_t exeBuf[MAX_PATH];
-    DWORD len = GetModuleFileNameW(nullptr, exeBuf, MAX_PATH);
-    if (len == 0) return;
-    if (len >= MAX_PATH) {
-        char w[256]; snprintf(w, sizeof(w), t(Str::WARN_PATH_TOO_LONG), MAX_PATH); fprintf(stderr, "%s\n", w);
-        return;
+// Pfad zur teefax.ini neben der .exe; einmal ermittelt, leer bei Fehler.
+static const wstring& getIniPath() {
+    static const wstring path = [] {
+        wchar_t exeBuf[MAX_PATH];
+        DWORD len = GetModuleFileNameW(nullptr, exeBuf, MAX_PATH);
+        if (len == 0) return wstring();
+        if (len >= MAX_PATH) {
+            char w[256]; snprintf(w, sizeof(w), t(Str::WARN_PATH_TOO_LONG), MAX_PATH); fprintf(stderr, "%s\n", w);
+            return wstring();
+        }
+        wstring p(exeBuf, len);
+        size_t slash = p.rfind(L'\\');
+        if (slash == wstring::npos) return wstring();
+        return p.substr(0, slash + 1) + L"teefax.ini";
+    }();
+    return path;
+}
+
+static string_view trimBlanks(string_view v) {
+    size_t s = v.find_first_not_of(" \t");
+    if (s == string_view::npos) return {};
+    return v.substr(s, v.find_last_not_of(" \t") - s + 1);
+}
+
+// Makrokopf "name" oder "name(a, b)" zerlegen; params ist der Text zwischen den
+// Klammern. false bei unvollständigen Klammern oder fehlendem Namen.
+static bool splitMacroSignature(string_view sig, string_view& name, string_view& params) {
+    sig          = trimBlanks(sig);
+    size_t open  = sig.find('(');
+    name         = trimBlanks(sig.substr(0, open));
+    params       = {};
+    if (open != string_view::npos) {
+        if (sig.back() != ')') return false;
+        params = trimBlanks(sig.substr(open + 1, sig.size() - open - 2));
     }
+    return !name.empty();
+}
 
-    wstring iniPath(exeBuf);
-    size_t slash = iniPath.rfind(L'\\');
-    if (slash == wstring::npos) return;
-    iniPath = iniPath.substr(0, slash + 1) + L"teefax.ini";
+// Parameterliste "a, b" in Namen zerlegen (leere Einträge bleiben erhalten,
+// damit die Prüfung beim Anlegen sie ablehnen kann).
+static vector<string> splitMacroParams(string_view params) {
+    vector<string> out;
+    if (params.empty()) return out;
+    size_t pos = 0;
+    for (;;) {
+        size_t comma = params.find(',', pos);
+        out.emplace_back(trimBlanks(params.substr(pos, comma - pos)));
+        if (comma == string_view::npos) break;
+        pos = comma + 1;
+    }
+    return out;
+}
 
-    FILE* f = _wfopen(iniPath.c_str(), L"r");
-    if (!f) return;
+// Gemeinsames Modell der teefax.ini: Die Datei wird einmal abgebildet und in
+// einem Durchgang in Zeilen, Standardargumente und Makros zerlegt. Alle Teile
+// sind string_views in die Abbildung; Zeilenlänge ist unbegrenzt.
+// Vor dem Überschreiben der Datei release() aufrufen, danach wird neu geladen.
+class IniConfig {
+public:
+    struct Macro { string_view name, params, value, line; };
+
+    static IniConfig& instance() { static IniConfig c; return c; }
+
+    // Gesamter Dateiinhalt; alle Views unten zeigen hinein.
+    string_view                text()        { load(); return textView; }
+    // Alle Zeilen ohne Zeilenende, in Dateireihenfolge.
+    const vector<string_view>& lines()       { load(); return lineViews; }
+    // Zeilen mit Standardargumenten (weder Kommentar noch Makro).
+    const vector<string_view>& argLines()    { load(); return argViews; }
+    // Makros in Dateireihenfolge; bei doppelten Namen zählt die letzte Zeile.
+    const vector<Macro>&       macros()      { load(); return macroList; }
+
+    // Größe und Änderungszeit der abgebildeten Datei (false: keine ini).
+    bool stamp(uint64_t& size, uint64_t& writeTime) {
+        load();
+        size      = fileSize;
+        writeTime = fileTime;
+        return hFile != INVALID_HANDLE_VALUE;
+    }
+
+    const Macro* findMacro(string_view name) {
+        load();
+        auto it = macroIndex.find(name);
+        return it == macroIndex.end() ? nullptr : &macroList[it->second];
+    }
+
+    // Gültiger (nicht überschriebener) Eintrag in macros()?
+    bool isCurrent(size_t i) {
+        auto it = macroIndex.find(macroList[i].name);
+        return it != macroIndex.end() && it->second == i;
+    }
+
+    void release() {
+        textView = {};
+        lineViews.clear();
+        argViews.clear();
+        macroList.clear();
+        macroIndex.clear();
+        if (view)  { UnmapViewOfFile(view); view = nullptr; }
+        if (hMap)  { CloseHandle(hMap); hMap = nullptr; }
+        if (hFile != INVALID_HANDLE_VALUE) { CloseHandle(hFile); hFile = INVALID_HANDLE_VALUE; }
+        fileSize = fileTime = 0;
+        loaded = false;
+    }
+
+private:
+    IniConfig() = default;
+    ~IniConfig() { release(); }
+
+    void load() {
+        if (loaded) return;
+        loaded = true;
+        const wstring& path = getIniPath();
+        if (path.empty()) return;
+        hFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE) return;
+        BY_HANDLE_FILE_INFORMATION info{};
+        if (GetFileInformationByHandle(hFile, &info)) {
+            fileSize = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+            fileTime = (static_cast<uint64_t>(info.ftLastWriteTime.dwHighDateTime) << 32) |
+                       info.ftLastWriteTime.dwLowDateTime;
+        }
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(hFile, &size) || size.QuadPart == 0 || size.QuadPart > 0x7fffffff) return;
+        hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!hMap) return;
+        view = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+        if (!view) return;
+        textView = string_view(static_cast<const char*>(view), static_cast<size_t>(size.QuadPart));
+        parse(textView);
+    }
+
+    void parse(string_view text) {
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t nl = text.find('\n', pos);
+            if (nl == string_view::npos) nl = text.size();
+            string_view line = text.substr(pos, nl - pos);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            lineViews.push_back(line);
+            pos = nl + 1;
+
+            string_view body = trimBlanks(line);
+            if (body.empty() || body[0] == '#') continue;          // Kommentarzeile
+            if (body.substr(0, 6) != "macro ") { argViews.push_back(body); continue; }
+
+            // Erwartet: "macro <name>[(<parameter>)] = <args>"
+            size_t eq = body.find('=', 6);
+            if (eq == string_view::npos) continue;
+            string_view name, params;
+            if (!splitMacroSignature(body.substr(6, eq - 6), name, params)) continue;
+            macroIndex[name] = macroList.size();
+            macroList.push_back({name, params, trimBlanks(body.substr(eq + 1)), line});
+        }
+    }
+
+    bool                                 loaded = false;
+    HANDLE                               hFile  = INVALID_HANDLE_VALUE;
+    HANDLE                               hMap   = nullptr;
+    void*                                view   = nullptr;
+    uint64_t                             fileSize = 0, fileTime = 0;
+    string_view                          textView;
+    vector<string_view>                  lineViews;
+    vector<string_view>                  argViews;
+    vector<Macro>                        macroList;
+    unordered_map<string_view, size_t>   macroIndex;
+};
+
+// ── Makro-Cache (teefax.cache) ────────────────────────────────────────
+// Binärabbild der teefax.ini neben ihr: Standardargumente und Makros bereits
+// in Tokens zerlegt, Makronamen über eine Hash-Tabelle erreichbar. Gültig,
+// solange Größe und Änderungszeit der ini übereinstimmen; sonst wird es beim
+// nächsten Start aus IniConfig neu geschrieben. Ein Aufruf wie "teefax tee"
+// liest dann nur Dateiattribute, den Kopf und einen Tabelleneintrag.
+//
+// Aufbau (little endian): Header | Tabelle (slotCount × Slot) | Daten.
+// Tokenliste: u32 Anzahl, je Token u32 Länge + Bytes. Eintrag: u32 Namenslänge,
+// Name, Parameter als Tokenliste, Rumpf als Tokenliste. Slot.entry == 0 markiert
+// einen freien Platz.
+class MacroCache {
+public:
+    static MacroCache& instance() { static MacroCache c; return c; }
+
+    // Cache abbilden und gegen die aktuelle ini prüfen.
+    bool open() {
+        if (data) return true;
+        WIN32_FILE_ATTRIBUTE_DATA attr{};
+        if (!GetFileAttributesExW(getIniPath().c_str(), GetFileExInfoStandard, &attr)) return false;
+        const uint64_t iniSize = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+        const uint64_t iniTime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) |
+                                 attr.ftLastWriteTime.dwLowDateTime;
+
+        hFile = CreateFileW(cachePath().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER fsize{};
+        if (GetFileSizeEx(hFile, &fsize) && fsize.QuadPart >= static_cast<LONGLONG>(sizeof(Header)) &&
+            fsize.QuadPart <= 0x7fffffff && (hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr)))
+            view = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+        if (view) {
+            const auto* bytes = static_cast<const char*>(view);
+            memcpy(&head, bytes, sizeof(head));
+            size = static_cast<uint32_t>(fsize.QuadPart);
+            const bool ok = memcmp(head.magic, MAGIC, 4) == 0 && head.fileSize == size &&
+                            head.iniSize == iniSize && head.iniWriteTime == iniTime &&
+                            head.slotCount != 0 && (head.slotCount & (head.slotCount - 1)) == 0 &&
+                            head.slotCount <= (size - sizeof(Header)) / sizeof(Slot);
+            if (ok) data = bytes;
+        }
+        if (!data) unmap();
+        return data != nullptr;
+    }
+
+    // Abbildung freigeben; das nächste open() prüft den Cache erneut gegen die ini.
+    void release() { unmap(); }
+
+    void appendDefaultArgs(vector<string>& out) const {
+        uint32_t off = head.argsOffset;
+        readTokens(off, &out);
+    }
+
+    // Makro nachschlagen; hängt Parameternamen und Rumpf-Tokens an.
+    bool find(string_view name, vector<string>& params, vector<string>& out) const {
+        const uint32_t h    = nameHash(name);
+        const uint32_t mask = head.slotCount - 1;
+        for (uint32_t i = 0; i <= mask; ++i) {
+            Slot slot;
+            memcpy(&slot, data + sizeof(Header) + ((h + i) & mask) * sizeof(Slot), sizeof(slot));
+            if (slot.entry == 0) return false;
+            if (slot.hash != h) continue;
+            uint32_t    off = slot.entry;
+            string_view stored;
+            if (!readBytes(off, stored)) return false;
+            if (stored == name) return readTokens(off, &params) && readTokens(off, &out);
+        }
+        return false;
+    }
+
+    // Aus dem geladenen ini-Modell neu schreiben (über eine temporäre Datei, damit
+    // parallele Starts nie einen halben Cache sehen). Fehler sind still: ohne
+    // Schreibrecht neben der exe wird eben jedes Mal die ini gelesen.
+    static void rebuild(IniConfig& ini) {
+        Header h{};
+        if (!ini.stamp(h.iniSize, h.iniWriteTime)) return;
+        memcpy(h.magic, MAGIC, 4);
+
+        // Nur gültige (nicht überschriebene) Makros; Tabelle höchstens halb voll
+        vector<size_t> current;
+        for (size_t i = 0; i < ini.macros().size(); ++i)
+            if (ini.isCurrent(i)) current.push_back(i);
+        h.slotCount = 8;
+        while (h.slotCount < current.size() * 2) h.slotCount <<= 1;
+
+        string buf(sizeof(Header) + h.slotCount * sizeof(Slot), '\0');
+        auto put32 = [&](uint32_t v) { buf.append(reinterpret_cast<const char*>(&v), 4); };
+        auto putBytes = [&](string_view v) { put32(static_cast<uint32_t>(v.size())); buf.append(v); };
+        auto putTokens = [&](const vector<string>& toks) {
+            put32(static_cast<uint32_t>(toks.size()));
+            for (const auto& tok : toks) putBytes(tok);
+        };
+
+        h.argsOffset = static_cast<uint32_t>(buf.size());
+        vector<string> args;
+        for (string_view line : ini.argLines())
+            for (auto& tok : tokenizeConfigLine(line)) args.push_back(move(tok));
+        putTokens(args);
+
+        for (size_t i : current) {
+            const IniConfig::Macro& m = ini.macros()[i];
+            Slot slot{nameHash(m.name), static_cast<uint32_t>(buf.size())};
+            putBytes(m.name);
+            putTokens(splitMacroParams(m.params));
+            putTokens(tokenizeConfigLine(m.value));
+            uint32_t at = slot.hash & (h.slotCount - 1);
+            while (reinterpret_cast<const Slot*>(buf.data() + sizeof(Header))[at].entry != 0)
+                at = (at + 1) & (h.slotCount - 1);
+            memcpy(&buf[sizeof(Header) + at * sizeof(Slot)], &slot, sizeof(slot));
+        }
+        h.fileSize = static_cast<uint32_t>(buf.size());
+        memcpy(&buf[0], &h, sizeof(h));
+
+        const wstring path = cachePath();
+        const wstring tmp  = path + L"." + to_wstring(GetCurrentProcessId());
+        HANDLE f = CreateFileW(tmp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (f == INVALID_HANDLE_VALUE) return;
+        DWORD written = 0;
+        bool  ok      = WriteFile(f, buf.data(), static_cast<DWORD>(buf.size()), &written, nullptr) &&
+                        written == buf.size();
+        CloseHandle(f);
+        if (!ok || !MoveFileExW(tmp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING))
+            DeleteFileW(tmp.c_str());
+    }
+
+private:
+    static constexpr char MAGIC[4] = {'T', 'F', 'C', '2'};
+
+    struct Header {
+        char     magic[4];
+        uint32_t fileSize;
+        uint64_t iniSize;
+        uint64_t iniWriteTime;
+        uint32_t slotCount;
+        uint32_t argsOffset;
+    };
+    struct Slot { uint32_t hash, entry; };
+
+    MacroCache() = default;
+    ~MacroCache() { unmap(); }
+
+    static wstring cachePath() {
+        const wstring& ini = getIniPath();
+        return ini.substr(0, ini.rfind(L'\\') + 1) + L"teefax.cache";
+    }
+
+    // FNV-1a; 0 ist für freie Slots nicht reserviert (entry unterscheidet sie).
+    static uint32_t nameHash(string_view name) {
+        uint32_t h = 2166136261u;
+        for (char c : name) { h ^= static_cast<unsigned char>(c); h *= 16777619u; }
+        return h;
+    }
+
+    // Begrenzte Leser: ein beschädigter Cache liefert "nicht gefunden" statt Müll.
+    bool readBytes(uint32_t& off, string_view& out) const {
+        uint32_t len = 0;
+        if (off > size || size - off < 4) return false;
+        memcpy(&len, data + off, 4);
+        off += 4;
+        if (size - off < len) return false;
+        out  = string_view(data + off, len);
+        off += len;
+        return true;
+    }
+
+    bool readTokens(uint32_t& off, vector<string>* out) const {
+        uint32_t count = 0;
+        if (off > size || size - off < 4) return false;
+        memcpy(&count, data + off, 4);
+        off += 4;
+        for (uint32_t i = 0; i < count; ++i) {
+            string_view tok;
+            if (!readBytes(off, tok)) return false;
+            if (out) out->emplace_back(tok);
+        }
+        return true;
+    }
+
+    void unmap() {
+        data = nullptr;
+        if (view)  { UnmapViewOfFile(view); view = nullptr; }
+        if (hMap)  { CloseHandle(hMap); hMap = nullptr; }
+        if (hFile != INVALID_HANDLE_VALUE) { CloseHandle(hFile); hFile = INVALID_HANDLE_VALUE; }
+    }
 
-    char buf[1024];
-    while (fgets(buf, sizeof(buf), f)) {
-        string line(buf);
-        // Zeilenende abschneiden
-        while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
-            line.pop_back();
-        // Führende Leerzeichen / Tabs überspringen
-        size_t start = line.find_first_not_of(" \t");
-        if (start == string::npos) continue;
-        line = line.substr(start);
-        if (line[0] == '#') continue; // Kommentarzeile
-        if (line.rfind("macro ", 0) == 0) continue; // Makro-Definition, nicht als Argument laden
+    HANDLE      hFile = INVALID_HANDLE_VALUE;
+    HANDLE      hMap  = nullptr;
+    void*       view  = nullptr;
+    const char* data  = nullptr;
+    uint32_t    size  = 0;
+    Header      head{};
+};
+
+// Hängt die Standardargumente aus der teefax.ini an 'out' an. Fehlt die Datei,
+// passiert nichts. Bevorzugt den Makro-Cache; ist er veraltet, wird die ini
+// gelesen und der Cache für den nächsten Start neu geschrieben.
+static void loadConfigArgs(vector<string>& out) {
+    MacroCache& cache = MacroCache::instance();
+    if (cache.open()) { cache.appendDefaultArgs(out); return; }
+    IniConfig& ini = IniConfig::instance();
+    for (string_view line : ini.argLines())
         for (auto& tok : tokenizeConfigLine(line))
-            out.push_back(tok);
+            out.push_back(move(tok));
+    MacroCache::rebuild(ini);
+}
+
+// Parameter und Rumpf-Tokens eines Makros (aus dem Cache oder dem ini-Modell);
+// false, wenn unbekannt.
+static bool lookupMacro(string_view name, vector<string>& params, vector<string>& tokens) {
+    MacroCache& cache = MacroCache::instance();
+    if (cache.open()) return cache.find(name, params, tokens);
+    const IniConfig::Macro* m = IniConfig::instance().findMacro(name);
+    if (!m) return false;
+    params = splitMacroParams(m->params);
+    tokens = tokenizeConfigLine(m->value);
+    return true;
+}
+
+// ── Schreiben der teefax.ini ──────────────────────────────────────────
+// Änderungen laufen unter einer prozessübergreifenden Sperre (LockFileEx auf
+// teefax.lock neben der ini), damit parallele Aufrufe sich nicht gegenseitig
+// überschreiben; innerhalb der Sperre wird das Modell frisch geladen. Neue
+// Zeilen werden nur angehängt. Ersetzen und Löschen schreiben eine temporäre
+// Datei und tauschen sie mit MoveFileExW aus: Ein Absturz hinterlässt die alte
+// oder die neue Fassung, nie eine halbe.
+class IniEditLock {
+public:
+    IniEditLock() {
+        const wstring& ini = getIniPath();
+        if (ini.empty()) return;
+        wstring path = ini.substr(0, ini.rfind(L'\\') + 1) + L"teefax.lock";
+        hFile = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE) return;
+        OVERLAPPED ov{};
+        locked = LockFileEx(hFile, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &ov) != FALSE;
+        IniConfig::instance().release(); // Stand anderer Prozesse übernehmen
     }
-    fclose(f);
+    ~IniEditLock() {
+        if (locked) {
+            OVERLAPPED ov{};
+            UnlockFileEx(hFile, 0, MAXDWORD, MAXDWORD, &ov);
+        }
+        if (hFile != INVALID_HANDLE_VALUE) CloseHandle(hFile);
+    }
+    IniEditLock(const IniEditLock&)            = delete;
+    IniEditLock& operator=(const IniEditLock&) = delete;
+
+    bool ok() const { return locked; }
+
+private:
+    HANDLE hFile  = INVALID_HANDLE_VALUE;
+    bool   locked = false;
+};
+
+// Bytes [from, to) der ini durch text ersetzen.
+struct IniEdit {
+    size_t from, to;
+    string text;
+};
+
+// Zeilenumbruch der bestehenden Datei übernehmen (neue Dateien: Windows-Stil).
+static string_view iniNewline(string_view text) {
+    return text.empty() || text.find("\r\n") != string_view::npos ? "\r\n" : "\n";
 }
 
-// ── Makro-System ──────────────────────────────────────────────────────
+// Bytebereich einer Modellzeile samt Zeilenumbruch (zum Löschen).
+static IniEdit iniLineRange(string_view text, string_view line) {
+    size_t from = static_cast<size_t>(line.data() - text.data());
+    size_t to   = from + line.size();
+    if (to < text.size() && text[to] == '\r') ++to;
+    if (to < text.size() && text[to] == '\n') ++to;
+    return {from, to, string()};
+}
+
+// Nur unter IniEditLock: eine Zeile ans Ende anhängen, Kosten unabhängig von der
+// Dateigröße. Fehlt der Umbruch nach der letzten Zeile, wird er ergänzt.
+static bool appendIniLine(const string& line) {
+    IniConfig&  ini  = IniConfig::instance();
+    string_view text = ini.text();
+    string_view nl   = iniNewline(text);
+    string      out;
+    if (!text.empty() && text.back() != '\n') out += nl;
+    out += line;
+    out += nl;
+    ini.release();
+
+    HANDLE f = CreateFileW(getIniPath().c_str(), FILE_APPEND_DATA,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (f == INVALID_HANDLE_VALUE) return false;
+    DWORD written = 0;
+    bool  ok = WriteFile(f, out.data(), static_cast<DWORD>(out.size()), &written, nullptr) &&
+               written == out.size();
+    ok = FlushFileBuffers(f) && ok;
+    CloseHandle(f);
+    return ok;
+}
 
-// Pfad zur teefax.ini ermitteln (wird von mehreren Makro-Funktionen benoetigt)
-static wstring getIniPath() {
-    wchar_t exeBuf[MAX_PATH];
-    DWORD len = GetModuleFileNameW(nullptr, exeBuf, MAX_PATH);
-    if (len == 0) return L"";
-    if (len >= MAX_PATH) {
-        char w[256]; snprintf(w, sizeof(w), t(Str::WARN_PATH_TOO_LONG), MAX_PATH); fprintf(stderr, "%s\n", w);
-        return L"";
-    }
-    wstring p(exeBuf);
-    size_t slash = p.rfind(L'\\');
-    if (slash == wstring::npos) return L"";
-    return p.substr(0, slash + 1) + L"teefax.ini";
-}
-
-// Alle Makros aus der ini laden: "macro <name> = <args>" -> map
-static unordered_map<string,string> loadMacros() {
-    unordered_map<string,string> macros;
-    wstring iniPath = getIniPath();
-    if (iniPath.empty()) return macros;
-
-    FILE* f = _wfopen(iniPath.c_str(), L"r");
-    if (!f) return macros;
-
-    char buf[1024];
-    while (fgets(buf, sizeof(buf), f)) {
-        string line(buf);
-        while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
-            line.pop_back();
-        size_t start = line.find_first_not_of(" \t");
-        if (start == string::npos) continue;
-        line = line.substr(start);
-        if (line[0] == '#') continue;
-
-        // Erwartet: "macro <name> = <args>"
-        if (line.rfind("macro ", 0) != 0) continue;
-        size_t nameStart = 6; // nach "macro "
-        size_t eq = line.find('=', nameStart);
-        if (eq == string::npos) continue;
-
-        string name = line.substr(nameStart, eq - nameStart);
-        size_t ns = name.find_first_not_of(" \t");
-        size_t ne = name.find_last_not_of(" \t");
-        if (ns == string::npos) continue;
-        name = name.substr(ns, ne - ns + 1);
-
-        string value = line.substr(eq + 1);
-        size_t vs = value.find_first_not_of(" \t");
-        if (vs != string::npos) value = value.substr(vs);
-        size_t ve = value.find_last_not_of(" \t");
-        if (ve != string::npos) value = value.substr(0, ve + 1);
-
-        if (!name.empty()) macros[name] = value;
+// Nur unter IniEditLock: Bereiche ersetzen (aufsteigend, ohne Überlappung) und
+// die ini atomar austauschen. Unveränderte Abschnitte werden am Stück aus der
+// Abbildung kopiert, ohne sie erneut zu zerlegen.
+static bool rewriteIni(const vector<IniEdit>& edits) {
+    IniConfig&     ini  = IniConfig::instance();
+    string_view    text = ini.text();
+    const wstring& path = getIniPath();
+    const wstring  tmp  = path + L"." + to_wstring(GetCurrentProcessId());
+    HANDLE f = CreateFileW(tmp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (f == INVALID_HANDLE_VALUE) return false;
+
+    bool ok  = true;
+    auto put = [&](string_view part) {
+        DWORD written = 0;
+        if (ok && !part.empty())
+            ok = WriteFile(f, part.data(), static_cast<DWORD>(part.size()), &written, nullptr) &&
+                 written == part.size();
+    };
+    size_t pos = 0;
+    for (const auto& e : edits) {
+        put(text.substr(pos, e.from - pos));
+        put(e.text);
+        pos = e.to;
     }
-    fclose(f);
-    return macros;
+    put(text.substr(pos));
+    ok = FlushFileBuffers(f) && ok;
+    CloseHandle(f);
+
+    ini.release(); // die abgebildete Fassung darf beim Austausch nicht mehr offen sein
+    if (!ok || !MoveFileExW(tmp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        DeleteFileW(tmp.c_str());
+        return false;
+    }
+    return true;
 }
 
+// ── Makro-System ──────────────────────────────────────────────────────
+
 // Reservierte Namen: alle bekannten Flags und Kurzformen
 static bool isMacroNameReserved(const string& name) {
     static const vector<string> reserved = {
@@ -1122,7 +1580,10 @@ static bool isMacroNameReserved(const string& name) {
         "--open","-o","--cmd","-c","--focus","-f","--prealarm","-pa",
         "--time","-t","--stopwatch","-sw","--daily","-d","--every","-e",
         "--nosleep","-ns","--lang","-la","--version","-v","--help","-h",
-        "--macro","--for"
+        "--macro","--for","--audio-backend","--audio-open-ms","--audio-latency-ms",
+        "--calibrate-audio","--tone","--metronome","--beep-every","--accent",
+        "--output","--output-tick","--bar","--fps","--laps","--sw",
+        "--status","--attach","--control","--watch-config"
     };
     for (const auto& r : reserved)
         if (name == r) return true;
@@ -1144,131 +1605,70 @@ static bool isMacroSubCmdValid(const string& subcmd) {
     // return true;
 }
 
-// Makro in ini schreiben (neu oder ueberschreiben).
-// Bestehende "macro <name> = ..."-Zeile wird ersetzt, sonst ans Ende angehaengt.
-static void saveMacroToIni(const string& name, const string& args) {
-    wstring iniPath = getIniPath();
-    if (iniPath.empty()) return;
-
-    vector<string> lines;
-    FILE* f = _wfopen(iniPath.c_str(), L"r");
-    if (f) {
-        char buf[1024];
-        while (fgets(buf, sizeof(buf), f)) {
-            string line(buf);
-            while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
-                line.pop_back();
-            lines.push_back(line);
-        }
-        fclose(f);
-    }
-
-    string entry  = "macro " + name + " = " + args;
-    string prefix = "macro " + name + " ";
-
-    bool replaced = false;
-    for (auto& line : lines) {
-        string trimmed = line;
-        size_t s = trimmed.find_first_not_of(" \t");
-        if (s != string::npos) trimmed = trimmed.substr(s);
-        if (trimmed.rfind(prefix, 0) == 0 && trimmed.find('=') != string::npos) {
-            line = entry;
-            replaced = true;
-            break;
-        }
-    }
-    if (!replaced) lines.push_back(entry);
-
-    FILE* fw = _wfopen(iniPath.c_str(), L"w");
-    if (!fw) return;
-    for (const auto& line : lines)
-        fprintf(fw, "%s\n", line.c_str());
-    fclose(fw);
+// Makro in ini schreiben (neu oder ueberschreiben). Die gültige "macro <name> = ..."-
+// Zeile wird ersetzt, ein neues Makro nur angehängt. signature: "name" oder
+// "name(a, b)". Rückgabe: false bei Schreibfehler.
+static bool saveMacroToIni(const string& signature, const string& args) {
+    string_view name, params;
+    if (!splitMacroSignature(signature, name, params)) return false;
+    IniEditLock lock;
+    if (!lock.ok()) return false;
+    IniConfig&              ini   = IniConfig::instance();
+    const string            entry = "macro " + signature + " = " + args;
+    const IniConfig::Macro* m     = ini.findMacro(name);
+    if (!m) return appendIniLine(entry);
+    size_t from = static_cast<size_t>(m->line.data() - ini.text().data());
+    return rewriteIni({{from, from + m->line.size(), entry}});
 }
 
-// Makro aus ini entfernen; gibt true zurueck wenn gefunden und entfernt
-static bool removeMacroFromIni(const string& name) {
-    wstring iniPath = getIniPath();
-    if (iniPath.empty()) return false;
+// Makro aus ini entfernen (alle Zeilen dieses Namens); gibt true zurueck wenn
+// gefunden und entfernt
+static bool removeMacroFromIni(const string& signature) {
+    string_view name, params;
+    if (!splitMacroSignature(signature, name, params)) return false;
+    IniEditLock lock;
+    if (!lock.ok()) return false;
+    IniConfig&      ini = IniConfig::instance();
+    vector<IniEdit> edits;
+    for (const auto& m : ini.macros())
+        if (m.name == name) edits.push_back(iniLineRange(ini.text(), m.line));
+    return !edits.empty() && rewriteIni(edits);
+}
 
-    vector<string> lines;
-    FILE* f = _wfopen(iniPath.c_str(), L"r");
-    if (!f) return false;
-    char buf[1024];
-    while (fgets(buf, sizeof(buf), f)) {
-        string line(buf);
-        while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
-            line.pop_back();
-        lines.push_back(line);
-    }
-    fclose(f);
+// ── Ende Makro-System ─────────────────────────────────────────────────
 
-    string prefix = "macro " + name + " ";
-    bool found = false;
-    vector<string> kept;
-    for (const auto& line : lines) {
-        string trimmed = line;
-        size_t s = trimmed.find_first_not_of(" \t");
-        if (s != string::npos) trimmed = trimmed.substr(s);
-        if (!found && trimmed.rfind(prefix, 0) == 0 && trimmed.find('=') != string::npos) {
-            found = true; // diese Zeile weglassen
-        } else {
-            kept.push_back(line);
-        }
+// Schreibt eine Einstellung "<key> <value>" in die teefax.ini. Ersetzt wird nur
+// eine Zeile, die allein aus diesem Schalter (und höchstens einem Wert) besteht,
+// aktiv oder unmittelbar auskommentiert ("#<key> <wert>"). Hilfekommentare wie
+// "#   <key> 500   Beschreibung" und Zeilen mit weiteren Schaltern bleiben stehen;
+// dann wird die Zeile angehaengt (spätere Angaben haben Vorrang).
+// Rückgabe: false, wenn die Datei nicht schreibbar ist.
+static bool saveIniSetting(const string& key, const string& value) {
+    IniEditLock lock;
+    if (!lock.ok()) return false;
+    IniConfig&   ini   = IniConfig::instance();
+    const string entry = key + " " + value;
+    for (string_view line : ini.lines()) {
+        string_view body = trimBlanks(line);
+        if (!body.empty() && body[0] == '#') body.remove_prefix(1);
+        if (body.compare(0, key.size(), key) != 0 || body.find('#') != string_view::npos) continue;
+        vector<string> tokens = tokenizeConfigLine(body);
+        if (tokens[0] != key || tokens.size() > 2 || (tokens.size() == 2 && tokens[1][0] == '-')) continue;
+        size_t from = static_cast<size_t>(line.data() - ini.text().data());
+        return rewriteIni({{from, from + line.size(), entry}});
     }
-    if (!found) return false;
-
-    FILE* fw = _wfopen(iniPath.c_str(), L"w");
-    if (!fw) return false;
-    for (const auto& line : kept)
-        fprintf(fw, "%s\n", line.c_str());
-    fclose(fw);
-    return true;
+    return appendIniLine(entry);
 }
 
-// ── Ende Makro-System ─────────────────────────────────────────────────
-
-// Erkennt, ob Teefax aus einer bestehenden Konsole aufgerufen wurde
-// oder ob Windows selbst die Konsole erstellt hat (= Doppelklick)
-// Erzeugt einen WAV-Puffer mit 1 Sekunde Stille (22050 Hz, 16-bit, mono).
-// Wird einmalig aufgebaut. Zeiger bleibt fuer die Lebensdauer des Programms gueltig.
-static const vector<uint8_t>& silentWav() {
-    static vector<uint8_t> wav = [](){
-        constexpr uint32_t RATE  = 22050;
-        constexpr uint32_t DSIZE = RATE * 2; // 1s, 16-bit mono = 44100 Bytes
-        vector<uint8_t> w(44 + DSIZE, 0);
-        auto w16 = [&](size_t o, uint16_t v){ memcpy(w.data()+o, &v, 2); };
-        auto w32 = [&](size_t o, uint32_t v){ memcpy(w.data()+o, &v, 4); };
-        memcpy(w.data()+0,  "RIFF", 4); w32(4,  36 + DSIZE);
-        memcpy(w.data()+8,  "WAVE", 4);
-        memcpy(w.data()+12, "fmt ", 4); w32(16, 16);
-        w16(20, 1); w16(22, 1); w32(24, RATE); w32(28, RATE*2); w16(32, 2); w16(34, 16);
-        memcpy(w.data()+36, "data", 4); w32(40, DSIZE);
-        // w[44..] = 0 (Stille, bereits initialisiert)
-        return w;
-    }();
-    return wav;
-}
-
-// Erzeugt einen ~10 ms langen Stille-Puffer (einmalig).
-// Zweck: winmm synchron initialisieren, bevor der Voralarm-Puffer abgespielt wird.
-// Ohne diesen Aufruf kann die Audio-Initialisierung (100-500 ms auf Frischstarts)
-// in die Voralarm-Stille fallen und den ersten Beep verschlucken.
-static const vector<uint8_t>& tinyInitWav() {
-    static vector<uint8_t> wav = [](){
-        constexpr uint32_t RATE  = 22050;
-        constexpr uint32_t DSIZE = (RATE / 100) * 2; // ~10 ms, 16-bit mono = 440 Bytes
-        vector<uint8_t> w(44 + DSIZE, 0);
-        auto w16 = [&](size_t o, uint16_t v){ memcpy(w.data()+o, &v, 2); };
-        auto w32 = [&](size_t o, uint32_t v){ memcpy(w.data()+o, &v, 4); };
-        memcpy(w.data()+0,  "RIFF", 4); w32(4,  36 + DSIZE);
-        memcpy(w.data()+8,  "WAVE", 4);
-        memcpy(w.data()+12, "fmt ", 4); w32(16, 16);
-        w16(20, 1); w16(22, 1); w32(24, RATE); w32(28, RATE*2); w16(32, 2); w16(34, 16);
-        memcpy(w.data()+36, "data", 4); w32(40, DSIZE);
-        return w;
-    }();
-    return wav;
+// Schreibt einen 44-Byte-WAV-Header (22050 Hz, 16-bit, mono) nach 'w'.
+static void writeWavHeader(uint8_t* w, uint32_t dataBytes) {
+    auto w16 = [&](size_t o, uint16_t v){ memcpy(w+o, &v, 2); };
+    auto w32 = [&](size_t o, uint32_t v){ memcpy(w+o, &v, 4); };
+    memcpy(w+0,  "RIFF", 4); w32(4,  36 + dataBytes);
+    memcpy(w+8,  "WAVE", 4);
+    memcpy(w+12, "fmt ", 4); w32(16, 16);
+    w16(20, 1); w16(22, 1); w32(24, 22050); w32(28, 22050*2); w16(32, 2); w16(34, 16);
+    memcpy(w+36, "data", 4); w32(40, dataBytes);
 }
 
 // Generiert einen WAV-Puffer fuer den gesamten Voralarm-Zeitraum:
@@ -1284,9 +1684,8 @@ static vector<uint8_t> buildPreAlarmWav(int count, int prewarmMs = 2000) {
     constexpr uint32_t BEEP_SAMPLES = RATE * 100 / 1000; // 100 ms = 2205 Samples
     constexpr float    FREQ         = 880.0f;
     constexpr float    PI2          = 6.28318530f;
-    // Amplitude des Voralarm-Beeps: reiner Sinuston klingt psychoakustisch lauter
-    // als ein gleich starkes Breitbandsignal; daher deutlich unter dem Pegel des
-    // eingebetteten Alarmtons halten. Bereich 0.15..0.40 je nach Geschmack.
+    // Rohpegel des Voralarm-Beeps im Puffer. Die Wiedergabelautstärke bestimmt
+    // preAlarmGain() (Lautheitsmessung, PREALARM_OFFSET_DB unter dem Weckton).
     constexpr float    AMPLITUDE    = 0.25f;
 
     const uint32_t prewarmSamples = static_cast<uint32_t>(prewarmMs) * RATE / 1000;
@@ -1295,14 +1694,7 @@ static vector<uint8_t> buildPreAlarmWav(int count, int prewarmMs = 2000) {
     const uint32_t DSIZE          = totalSamples * 2;                  // 16-bit mono
 
     vector<uint8_t> w(44 + DSIZE, 0);
-    auto w16 = [&](size_t o, uint16_t v){ memcpy(w.data()+o, &v, 2); };
-    auto w32 = [&](size_t o, uint32_t v){ memcpy(w.data()+o, &v, 4); };
-
-    memcpy(w.data()+0,  "RIFF", 4); w32(4,  36 + DSIZE);
-    memcpy(w.data()+8,  "WAVE", 4);
-    memcpy(w.data()+12, "fmt ", 4); w32(16, 16);
-    w16(20, 1); w16(22, 1); w32(24, RATE); w32(28, RATE*2); w16(32, 2); w16(34, 16);
-    memcpy(w.data()+36, "data", 4); w32(40, DSIZE);
+    writeWavHeader(w.data(), DSIZE);
 
     auto* samples = reinterpret_cast<int16_t*>(w.data() + 44);
     const uint32_t FADE = BEEP_SAMPLES / 10;
@@ -1321,802 +1713,4099 @@ static vector<uint8_t> buildPreAlarmWav(int count, int prewarmMs = 2000) {
     return w;
 }
 
-bool launchedFromExistingConsole() {
-    HWND hwnd = GetConsoleWindow();
-    if (!hwnd) return false;
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Audio-Mixer ────────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
 
-    DWORD consoleProc = 0;
-    GetWindowThreadProcessId(hwnd, &consoleProc);
+// PlaySound kennt pro Prozess nur EINEN Klang: Stille-Loop, Voralarm und Alarmton
+// ueberschrieben sich gegenseitig. Der Mixer haelt stattdessen ein waveOut-Geraet
+// offen und mischt auf einem eigenen Audio-Thread beliebig viele Stimmen mit
+// jeweils eigenem Pegel. Solange das Geraet offen ist, laeuft durchgehend Stille
+// (BT-Keepalive ohne Soundwechsel, ohne Knacken, ohne erneutes Oeffnen).
+// Format wie alle eingebauten Klaenge: 22050 Hz, 16-bit, mono.
+constexpr uint32_t MIX_RATE    = 22050;
+constexpr int      MIX_BLOCK   = MIX_RATE / 50; // 20 ms pro Puffer (441 Samples)
+constexpr int      MIX_BUFFERS = 4;             // 80 ms Vorlauf im Treiber
+// Ohne Stimmen und ohne Keepalive wird das Geraet nach dieser Zeit geschlossen,
+// damit ein stundenlanger --daily-Lauf den Standby nicht dauerhaft blockiert.
+constexpr int      MIX_IDLE_CLOSE_SEC = 30;
+
+using PcmPtr = shared_ptr<const vector<int16_t>>;
+
+// Liest die Samples aus einem WAV-Puffer im Mixer-Format (16-bit mono, MIX_RATE).
+// Chunks werden der Reihe nach durchlaufen, "fmt " muss nicht an Offset 12 stehen.
+// Rückgabe: nullptr bei fremdem Format (Aufrufer weicht dann auf PlaySound aus).
+static PcmPtr pcmFromWav(const uint8_t* wav, size_t size) {
+    if (size < 12 || memcmp(wav, "RIFF", 4) != 0 || memcmp(wav + 8, "WAVE", 4) != 0)
+        return nullptr;
+    bool fmtOk = false;
+    size_t pos = 12;
+    while (pos + 8 <= size) {
+        uint32_t len = 0;
+        memcpy(&len, wav + pos + 4, 4);
+        const uint8_t* body = wav + pos + 8;
+        size_t avail = size - (pos + 8);
+        if (len > avail) len = static_cast<uint32_t>(avail);
+        if (memcmp(wav + pos, "fmt ", 4) == 0 && len >= 16) {
+            uint16_t tag, channels, bits; uint32_t rate;
+            memcpy(&tag, body, 2); memcpy(&channels, body + 2, 2);
+            memcpy(&rate, body + 4, 4); memcpy(&bits, body + 14, 2);
+            fmtOk = tag == 1 && channels == 1 && rate == MIX_RATE && bits == 16;
+        } else if (memcmp(wav + pos, "data", 4) == 0) {
+            if (!fmtOk) return nullptr;
+            auto pcm = make_shared<vector<int16_t>>(len / 2);
+            memcpy(pcm->data(), body, pcm->size() * 2);
+            return pcm;
+        }
+        pos += 8 + len + (len & 1); // Chunks sind auf gerade Laengen aufgefuellt
+    }
+    return nullptr;
+}
 
-    // Wenn die Konsole einem anderen Prozess gehört, wurde sie geerbt
-    return (consoleProc != GetCurrentProcessId());
+// Addiert 'n' Samples mit Pegel 'gain' auf den Akkumulator (SSE2: 8 Samples je Schritt).
+static void mixAccumulate(float* acc, const int16_t* src, int n, float gain) {
+    int i = 0;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    const __m128 g = _mm_set1_ps(gain);
+    for (; i + 8 <= n; i += 8) {
+        __m128i s  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // int16 -> int32 mit Vorzeichen: in die obere Haelfte schieben, arithmetisch zurück
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+        _mm_storeu_ps(acc + i,     _mm_add_ps(_mm_loadu_ps(acc + i),     _mm_mul_ps(_mm_cvtepi32_ps(lo), g)));
+        _mm_storeu_ps(acc + i + 4, _mm_add_ps(_mm_loadu_ps(acc + i + 4), _mm_mul_ps(_mm_cvtepi32_ps(hi), g)));
+    }
+#endif
+    for (; i < n; ++i) acc[i] += static_cast<float>(src[i]) * gain;
 }
 
+// Wandelt den Akkumulator in 16-bit-Samples; Übersteuerung wird gesättigt statt umzukippen.
+static void mixStore(int16_t* out, const float* acc, int n) {
+    int i = 0;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    for (; i + 8 <= n; i += 8) {
+        __m128i lo = _mm_cvtps_epi32(_mm_loadu_ps(acc + i));
+        __m128i hi = _mm_cvtps_epi32(_mm_loadu_ps(acc + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+    for (; i < n; ++i) {
+        float v = acc[i];
+        if (v >  32767.0f) v =  32767.0f;
+        if (v < -32768.0f) v = -32768.0f;
+        out[i] = static_cast<int16_t>(lrintf(v));
+    }
+}
 
-// ═══════════════════════════════════════════════════════════════════════════
-// ── Konfigurationsstruktur ─────────────────────────────────────────────────
-// ═══════════════════════════════════════════════════════════════════════════
+// ── WAV-Dekoder und Resampler ─────────────────────────────────────────
+// --sound-Dateien werden beim Start einmal vollständig in das Mixer-Format
+// gewandelt, statt sie erst beim Ablauf über PlaySound und die ACM-Codecs des
+// Systems zu schicken. So kostet der Alarm unabhängig vom Quellformat gleich
+// wenig, und unlesbare Dateien fallen schon in doPreChecks() auf.
+// Unterstützt: PCM 8/16/24/32 Bit, IEEE-Float 32/64 Bit, IMA-ADPCM (4 Bit),
+// jeweils auch als WAVE_FORMAT_EXTENSIBLE und mit beliebig vielen Kanälen.
+
+// Skalarprodukt zweier float-Reihen (SSE2: 4 Produkte je Schritt).
+static float dotProduct(const float* a, const float* b, int n) {
+    int i = 0;
+    float sum = 0.0f;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4)
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    float part[4];
+    _mm_storeu_ps(part, acc);
+    sum = (part[0] + part[1]) + (part[2] + part[3]);
+#endif
+    for (; i < n; ++i) sum += a[i] * b[i];
+    return sum;
+}
 
-// Fasst alle geparsten Einstellungen zusammen.
-// Felder mit Laufzeit-Zustand (loopCount, atYear) werden zur Laufzeit verändert.
-struct TimerConfig {
-    // Ton
-    string    soundFile;
-    bool      mute          = false;
-    bool      asyncSound    = false;
-    long long alarmRepeat   = 1;
-    int       alarmInterval = 2;
+// Dekodiert einen IMA-ADPCM-Block (alle Kanäle) und mischt ihn auf mono in 'out'.
+static void decodeImaAdpcmBlock(const uint8_t* blk, size_t len, int channels,
+                                int samplesPerBlock, vector<float>& out) {
+    static const int16_t STEPS[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+        253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+        1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+        12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+    static const int8_t INDEX_ADJ[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+    if (len < static_cast<size_t>(4 * channels)) return;
+    const size_t base = out.size();
+    out.resize(base + samplesPerBlock, 0.0f);
+    const float scale = 1.0f / (32768.0f * channels);
+
+    for (int c = 0; c < channels; ++c) {
+        const uint8_t* hdr = blk + 4 * c;
+        int pred  = static_cast<int16_t>(hdr[0] | (hdr[1] << 8));
+        int index = min<int>(hdr[2], 88);
+        out[base] += pred * scale;
+        // Nutzdaten: je Kanal abwechselnd 4 Bytes = 8 Samples, niederwertiges Nibble zuerst
+        int n = 1;
+        for (size_t off = 4 * channels + 4 * c; off + 4 <= len && n < samplesPerBlock;
+             off += 4 * channels) {
+            for (int b = 0; b < 8 && n < samplesPerBlock; ++b, ++n) {
+                int nib  = (blk[off + b / 2] >> ((b & 1) * 4)) & 0x0F;
+                int step = STEPS[index];
+                int diff = step >> 3;
+                if (nib & 1) diff += step >> 2;
+                if (nib & 2) diff += step >> 1;
+                if (nib & 4) diff += step;
+                pred  = max(-32768, min(32767, (nib & 8) ? pred - diff : pred + diff));
+                index = max(0, min(88, index + INDEX_ADJ[nib & 7]));
+                out[base + n] += pred * scale;
+            }
+        }
+    }
+}
 
-    // Zeitangabe
-    long long ms            = 0;
-    bool      useAtTime     = false;
-    bool      useAtDateTime = false;
-    long long atYear = 0; // long long: sonst verfaelscht sscanf Jahreszahlen jenseits ~2,147 Mrd. lautlos
-    int       atMonth = 0, atDay = 0;
-    int       atHour = 0, atMinute = 0, atSecond = 0;
+// Dekodiert die Samples eines WAV-Puffers in ein Mono-Signal (-1..1) samt Abtastrate.
+// Rückgabe: false bei unbekanntem Format oder beschädigter Datei.
+static bool decodeWav(const uint8_t* wav, size_t size, vector<float>& mono, uint32_t& rate) {
+    if (size < 12 || memcmp(wav, "RIFF", 4) != 0 || memcmp(wav + 8, "WAVE", 4) != 0)
+        return false;
+    uint16_t tag = 0, channels = 0, blockAlign = 0, bits = 0, samplesPerBlock = 0;
+    bool fmtOk = false;
+    size_t pos = 12;
+    while (pos + 8 <= size) {
+        uint32_t len = 0;
+        memcpy(&len, wav + pos + 4, 4);
+        const uint8_t* body = wav + pos + 8;
+        size_t avail = size - (pos + 8);
+        if (len > avail) len = static_cast<uint32_t>(avail);
+        if (memcmp(wav + pos, "fmt ", 4) == 0 && len >= 16) {
+            memcpy(&tag, body, 2);         memcpy(&channels, body + 2, 2);
+            memcpy(&rate, body + 4, 4);    memcpy(&blockAlign, body + 12, 2);
+            memcpy(&bits, body + 14, 2);
+            if (tag == 0xFFFE && len >= 40) memcpy(&tag, body + 24, 2); // SubFormat-GUID
+            if (tag == 0x11 && len >= 20)   memcpy(&samplesPerBlock, body + 18, 2);
+            fmtOk = channels > 0 && rate >= 1000 && rate <= 384000 && blockAlign > 0;
+        } else if (memcmp(wav + pos, "data", 4) == 0) {
+            if (!fmtOk) return false;
+            mono.clear();
+            if (tag == 0x11) { // IMA-ADPCM
+                // samplesPerBlock muss zur Blockgröße passen (4-Byte-Kopf je Kanal, dann
+                // 2 Samples je Byte), sonst könnte eine kaputte Datei riesige Puffer anfordern.
+                if (bits != 4 || blockAlign < 4 * channels ||
+                    samplesPerBlock != (blockAlign - 4 * channels) * 2 / channels + 1 ||
+                    samplesPerBlock < 2)
+                    return false;
+                mono.reserve(static_cast<size_t>(len / blockAlign + 1) * samplesPerBlock);
+                for (size_t off = 0; off < len; off += blockAlign)
+                    decodeImaAdpcmBlock(body + off, min<size_t>(blockAlign, len - off),
+                                        channels, samplesPerBlock, mono);
+                return !mono.empty();
+            }
+            const int bytes = bits / 8;
+            if ((tag != 1 && tag != 3) || bits % 8 != 0 || blockAlign < bytes * channels)
+                return false;
+            if (tag == 1 && (bytes < 1 || bytes > 4)) return false;
+            if (tag == 3 && bytes != 4 && bytes != 8) return false;
+            const size_t frames = len / blockAlign;
+            const float  norm   = 1.0f / channels;
+            mono.resize(frames);
+            for (size_t f = 0; f < frames; ++f) {
+                const uint8_t* p = body + f * blockAlign;
+                float sum = 0.0f;
+                for (int c = 0; c < channels; ++c, p += bytes) {
+                    if (tag == 3 && bytes == 4)      { float v;  memcpy(&v, p, 4); sum += v; }
+                    else if (tag == 3)               { double v; memcpy(&v, p, 8); sum += static_cast<float>(v); }
+                    else if (bytes == 1)             sum += (p[0] - 128) / 128.0f; // 8 Bit ist vorzeichenlos
+                    else if (bytes == 2)             sum += static_cast<int16_t>(p[0] | (p[1] << 8)) / 32768.0f;
+                    else if (bytes == 3)             sum += static_cast<int32_t>((p[0] << 8) | (p[1] << 16) | (static_cast<uint32_t>(p[2]) << 24)) / 2147483648.0f;
+                    else                             { int32_t v; memcpy(&v, p, 4); sum += v / 2147483648.0f; }
+                }
+                mono[f] = sum * norm;
+            }
+            return frames > 0;
+        }
+        pos += 8 + len + (len & 1);
+    }
+    return false;
+}
 
-    // Schleife
-    bool      loop     = false;
-    int       maxLoops = -1;
+// Wandelt ein Mono-Signal von 'inRate' auf MIX_RATE (gefensterter Sinc, polyphase).
+// Beim Heruntertakten wird die Grenzfrequenz mit abgesenkt (Anti-Aliasing).
+static vector<float> resampleToMixRate(const vector<float>& in, uint32_t inRate) {
+    if (inRate == MIX_RATE) return in;
+    constexpr int   ZEROS  = 8;    // Nulldurchgänge je Seite
+    constexpr int   PHASES = 256;  // Auflösung der Teilsample-Position
+    constexpr float PI     = 3.14159265f;
+
+    const double ratio  = static_cast<double>(inRate) / MIX_RATE;
+    const float  cutoff = static_cast<float>(min(1.0, 1.0 / ratio));
+    const int    half   = static_cast<int>(ceilf(ZEROS / cutoff));
+    const int    taps   = (2 * half + 3) & ~3; // auf 4 aufgerundet (SSE2)
+
+    // Kernel-Tabelle: Zeile p enthält die Gewichte für Teilposition p / PHASES
+    vector<float> kernel(static_cast<size_t>(PHASES + 1) * taps, 0.0f);
+    for (int p = 0; p <= PHASES; ++p) {
+        const float frac = static_cast<float>(p) / PHASES;
+        for (int k = 0; k < 2 * half; ++k) {
+            const float x = (k - half + 1) - frac;  // Abstand zum Zielpunkt in Eingangs-Samples
+            const float u = x * cutoff;
+            const float sinc = fabsf(u) < 1e-6f ? 1.0f : sinf(PI * u) / (PI * u);
+            const float win  = 0.5f + 0.5f * cosf(PI * x / half); // Hann-Fenster
+            kernel[static_cast<size_t>(p) * taps + k] = fabsf(x) < half ? cutoff * sinc * win : 0.0f;
+        }
+    }
 
-    // Voralarm
-    int       preAlarmSeconds = 0;
+    vector<float> padded(in.size() + 2 * half + taps, 0.0f);
+    copy(in.begin(), in.end(), padded.begin() + half);
+
+    const size_t outLen = static_cast<size_t>(in.size() / ratio);
+    vector<float> out(outLen);
+    for (size_t n = 0; n < outLen; ++n) {
+        const double pos   = n * ratio;
+        const size_t whole = static_cast<size_t>(pos);
+        const int    phase = static_cast<int>((pos - whole) * PHASES + 0.5);
+        // Fenster beginnt bei Eingangs-Sample whole - half + 1 (in 'padded' um half verschoben)
+        out[n] = dotProduct(padded.data() + whole + 1, kernel.data() + static_cast<size_t>(phase) * taps, taps);
+    }
+    return out;
+}
 
-    // Benachrichtigung
-    bool      showMessage = true;
-    string    customMsg;
+// Größe und Änderungszeit einer Datei, ohne sie zu öffnen (false: fehlt).
+static bool fileStamp(const wstring& path, uint64_t& size, uint64_t& writeTime) {
+    WIN32_FILE_ATTRIBUTE_DATA attr{};
+    if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &attr)) return false;
+    size      = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+    writeTime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) |
+                attr.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
 
-    // Aktionen nach Ablauf
-    string    openFile;
-    string    cmdArg;
-    string    focusWindow;
+// ── Lautheit ──────────────────────────────────────────────────────────
+// Eigene Sounddateien sind so laut, wie sie aufgenommen wurden; eingebaute Klänge
+// und Voralarm haben feste Pegel. Damit alles ähnlich laut wirkt, wird jeder Klang
+// einmal vermessen (vereinfachte LUFS-Näherung: Hochpass gegen Tieftonanteile,
+// 400-ms-Fenster, absolutes und relatives Gate wie in ITU-R BS.1770) und mit einem
+// Pegel pro Stimme auf LOUDNESS_TARGET_DB gebracht. Die Spitze bleibt dabei unter
+// LOUDNESS_PEAK_LIMIT, leise Aufnahmen werden höchstens um LOUDNESS_MAX_BOOST_DB angehoben.
+constexpr float LOUDNESS_TARGET_DB    = -14.0f;
+constexpr float LOUDNESS_MAX_BOOST_DB =  12.0f;
+constexpr float LOUDNESS_MAX_CUT_DB   = -24.0f;
+constexpr float LOUDNESS_PEAK_LIMIT   =  0.98f;
+// Der Voralarm ist ein Hinweis, kein Alarm: bewusst etwas leiser als der Weckton.
+constexpr float PREALARM_OFFSET_DB    =  -6.0f;
+
+// Quadratsumme einer float-Reihe (SSE2: 4 Samples je Schritt).
+static double sumSquares(const float* x, size_t n) {
+    size_t i = 0;
+    float  sq = 0.0f;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        __m128 v = _mm_loadu_ps(x + i);
+        acc = _mm_add_ps(acc, _mm_mul_ps(v, v));
+    }
+    float a[4];
+    _mm_storeu_ps(a, acc);
+    sq = (a[0] + a[1]) + (a[2] + a[3]);
+#endif
+    for (; i < n; ++i) sq += x[i] * x[i];
+    return sq;
+}
 
-    // Modi
-    bool      showLiveTime  = false;
-    bool      showStopwatch = false;
-    bool      noSleep       = false;
-    bool      eco           = false;
+// Betragsmaximum einer float-Reihe (SSE2: 4 Samples je Schritt).
+static float peakAbs(const float* x, size_t n) {
+    size_t i = 0;
+    float  peak = 0.0f;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 top = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4)
+        top = _mm_max_ps(top, _mm_and_ps(_mm_loadu_ps(x + i), absMask));
+    float t[4];
+    _mm_storeu_ps(t, top);
+    peak = max(max(t[0], t[1]), max(t[2], t[3]));
+#endif
+    for (; i < n; ++i) peak = max(peak, fabsf(x[i]));
+    return peak;
+}
 
-    // Täglicher / wiederkehrender Alarm
-    vector<tuple<int,int,int>> dailyTimes;
-    bool      useDailyTimes = false;
-    EverySpec everySpec;
-    bool      useEvery      = false;
+// Liefert den Pegel (Faktor) für ein Signal in -1..1 bei MIX_RATE, damit es
+// LOUDNESS_TARGET_DB + offsetDb erreicht. Stille bleibt unverändert (1.0).
+static float loudnessGain(const float* x, size_t n, float offsetDb = 0.0f) {
+    if (n == 0) return 1.0f;
+    // Hochpass erster Ordnung bei ~100 Hz (grobe Näherung der K-Gewichtung)
+    const float a = expf(-6.28318530f * 100.0f / MIX_RATE);
+    vector<float> hp(n);
+    float prevIn = 0.0f, prevOut = 0.0f;
+    for (size_t i = 0; i < n; ++i) {
+        prevOut = a * (prevOut + x[i] - prevIn);
+        prevIn  = x[i];
+        hp[i]   = prevOut;
+    }
 
-    // --for: Gesamtlaufzeit der Schleife begrenzen
-    long long forMs  = 0;     // 0 = deaktiviert
-    bool      useFor = false;
+    // Mittlere Leistung je 100-ms-Block; Fenster = 4 Blöcke mit 75 % Überlappung
+    const size_t block = MIX_RATE / 10;
+    vector<double> blockPow;
+    for (size_t i = 0; i < n; i += block) {
+        size_t len = min(block, n - i);
+        blockPow.push_back(sumSquares(hp.data() + i, len) / len);
+    }
+    // Spitze am ungefilterten Signal (das wird ausgegeben)
+    const float rawPeak = peakAbs(x, n);
+
+    vector<double> windows;
+    if (blockPow.size() < 4) {
+        double total = 0.0;
+        for (double p : blockPow) total += p;
+        windows.push_back(total / blockPow.size()); // kürzer als 400 ms: ganzes Signal
+    } else {
+        for (size_t b = 0; b + 4 <= blockPow.size(); ++b)
+            windows.push_back((blockPow[b] + blockPow[b+1] + blockPow[b+2] + blockPow[b+3]) / 4.0);
+    }
 
-    // Schleifenzustand – wird zur Laufzeit verändert
-    long long loopCount = 0;
+    auto toDb = [](double p){ return 10.0 * log10(max(p, 1e-12)); };
+    auto gatedMean = [&](double thresholdDb) {
+        double sum = 0.0; int count = 0;
+        for (double w : windows)
+            if (toDb(w) > thresholdDb) { sum += w; ++count; }
+        return count ? sum / count : 0.0;
+    };
+    double absGated = gatedMean(-70.0);              // absolutes Gate: Stille ignorieren
+    if (absGated <= 0.0) return 1.0f;
+    double level = toDb(gatedMean(toDb(absGated) - 10.0)); // relatives Gate: leise Passagen
+
+    float gainDb = static_cast<float>(LOUDNESS_TARGET_DB + offsetDb - level);
+    gainDb = max(LOUDNESS_MAX_CUT_DB, min(LOUDNESS_MAX_BOOST_DB, gainDb));
+    float gain = powf(10.0f, gainDb / 20.0f);
+    if (rawPeak > 0.0f) gain = min(gain, LOUDNESS_PEAK_LIMIT / rawPeak);
+    return gain;
+}
+
+static float loudnessGain(const vector<int16_t>& pcm, float offsetDb = 0.0f) {
+    vector<float> x(pcm.size());
+    for (size_t i = 0; i < pcm.size(); ++i) x[i] = pcm[i] / 32768.0f;
+    return loudnessGain(x.data(), x.size(), offsetDb);
+}
+
+// Lautheits-Cache "teefax.loudness" neben der teefax.ini, eine Zeile je Sounddatei:
+// "<änderungszeit> <größe> <pegel> <pfad>". Der Schlüssel lässt sich ohne Lesen der
+// Sounddatei prüfen; eine geänderte Datei ersetzt ihre Zeile. Die Datei hält höchstens
+// LOUDNESS_CACHE_ENTRIES Zeilen (zuletzt gemessene am Ende, älteste fallen heraus).
+constexpr size_t LOUDNESS_CACHE_ENTRIES = 64;
+
+struct LoudnessEntry {
+    uint64_t writeTime, size;
+    float    gain;
+    string   path; // absolut, UTF-8
 };
 
-// ═══════════════════════════════════════════════════════════════════════════
-// ── Konsolenmodus-Helfer ───────────────────────────────────────────────────
-// ═══════════════════════════════════════════════════════════════════════════
+static wstring getLoudnessCachePath() {
+    const wstring& ini = getIniPath();
+    if (ini.empty()) return L"";
+    return ini.substr(0, ini.rfind(L'\\') + 1) + L"teefax.loudness";
+}
 
-// Deaktiviert QuickEdit im aktuellen Konsolenfenster.
-// Verhindert, dass ein Mausklick den Timer einfriert.
-static void disableQuickEdit() {
-    HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
-    DWORD  mode = 0;
-    if (GetConsoleMode(hIn, &mode)) {
-        mode &= ~ENABLE_QUICK_EDIT_MODE;
-        mode |=  ENABLE_EXTENDED_FLAGS;
-        SetConsoleMode(hIn, mode);
-        g_consoleModeChanged = true;
+static vector<LoudnessEntry> readLoudnessCache() {
+    vector<LoudnessEntry> entries;
+    wstring path = getLoudnessCachePath();
+    FILE* f = path.empty() ? nullptr : _wfopen(path.c_str(), L"r");
+    if (!f) return entries;
+    char line[4096];
+    while (fgets(line, sizeof(line), f) && entries.size() < LOUDNESS_CACHE_ENTRIES) {
+        unsigned long long t = 0, sz = 0; float g = 0.0f; int skip = 0;
+        if (sscanf(line, "%llx %llu %f %n", &t, &sz, &g, &skip) != 3 || g <= 0.0f || !line[skip]) continue;
+        string p(line + skip);
+        while (!p.empty() && (p.back() == '\n' || p.back() == '\r')) p.pop_back();
+        entries.push_back({t, sz, g, move(p)});
     }
+    fclose(f);
+    return entries;
 }
 
-// Stellt den gespeicherten Originalzustand des Konsolenmodus wieder her.
-static void restoreConsoleMode() {
-    if (g_consoleModeChanged) {
-        SetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), g_originalConsoleMode);
-        g_consoleModeChanged = false;
-    }
+static bool loadCachedGain(const string& path, uint64_t size, uint64_t writeTime, float& gain) {
+    for (const auto& e : readLoudnessCache())
+        if (e.size == size && e.writeTime == writeTime && e.path == path) {
+            gain = e.gain;
+            return true;
+        }
+    return false;
 }
 
-// ═══════════════════════════════════════════════════════════════════════════
-// ── Argument-Vorverarbeitung ───────────────────────────────────────────────
-// ═══════════════════════════════════════════════════════════════════════════
+// Unter IniEditLock lesen, Eintrag ersetzen und die Datei atomar austauschen;
+// parallel messende Prozesse verlieren so keine Zeilen.
+static void saveCachedGain(const string& path, uint64_t size, uint64_t writeTime, float gain) {
+    const wstring cache = getLoudnessCachePath();
+    if (cache.empty()) return;
+    IniEditLock lock;
+    if (!lock.ok()) return; // kein Schreibrecht neben der exe: beim nächsten Start erneut messen
+
+    vector<LoudnessEntry> entries = readLoudnessCache();
+    entries.erase(remove_if(entries.begin(), entries.end(),
+                            [&](const LoudnessEntry& e) { return e.path == path; }),
+                  entries.end());
+    entries.push_back({writeTime, size, gain, path});
+    if (entries.size() > LOUDNESS_CACHE_ENTRIES)
+        entries.erase(entries.begin(), entries.end() - LOUDNESS_CACHE_ENTRIES);
+
+    const wstring tmp = cache + L"." + to_wstring(GetCurrentProcessId());
+    FILE* f = _wfopen(tmp.c_str(), L"w");
+    if (!f) return;
+    bool ok = true;
+    for (const auto& e : entries)
+        ok = fprintf(f, "%016llx %llu %.6f %s\n", static_cast<unsigned long long>(e.writeTime),
+                     static_cast<unsigned long long>(e.size), e.gain, e.path.c_str()) > 0 && ok;
+    ok = fclose(f) == 0 && ok;
+    if (!ok || !MoveFileExW(tmp.c_str(), cache.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        DeleteFileW(tmp.c_str());
+}
 
-// Setzt TEEFAX_LANG anhand des letzten --lang-Vorkommens in der Argumentliste.
-// Wird zweimal aufgerufen: vor dem --macro-Handler (damit dessen Meldungen
-// bereits in der gewählten Sprache erscheinen) und nach der Makro-Expansion
-// (damit CLI-Argumente einen INI-Wert überschreiben können).
-static void detectLanguageFromArgs(const vector<string>& args) {
-    for (int i = 0; i + 1 < static_cast<int>(args.size()); ++i) {
-        if (args[i] == "--lang" || args[i] == "-la")
-            _putenv_s("TEEFAX_LANG", args[i + 1].c_str());
+// Lädt eine Sounddatei als Mixer-Stimme (einmal dekodiert, danach aus dem Cache;
+// neu dekodiert, sobald sich Größe oder Änderungszeit der Datei ändern).
+// 'gain' erhält den Lautheits-Pegel; er wird nur neu gemessen, wenn sich die Datei geändert hat.
+// Rückgabe: nullptr, wenn die Datei fehlt, nicht lesbar ist oder ihr Format nicht unterstützt wird.
+static PcmPtr loadSoundFile(const string& path, float* gain = nullptr) {
+    static mutex    cacheMtx;
+    static string   cachedPath;
+    static uint64_t cachedSize = 0, cachedTime = 0;
+    static PcmPtr   cached;
+    static float    cachedGain = 1.0f;
+    lock_guard<mutex> lk(cacheMtx);
+    const wstring wpath = toWideArgv(path);
+    uint64_t size = 0, writeTime = 0;
+    if (!fileStamp(wpath, size, writeTime)) return nullptr;
+    if (cached && path == cachedPath && size == cachedSize && writeTime == cachedTime) {
+        if (gain) *gain = cachedGain;
+        return cached;
+    }
+    // Gemessenen Pegel vor dem Dekodieren nachschlagen (Pfad, Größe, Änderungszeit)
+    error_code ec;
+    const string key   = fromWide(fs::absolute(fs::path(wpath), ec).wstring(), CP_UTF8);
+    float        level = 1.0f;
+    const bool   known = loadCachedGain(key, size, writeTime, level);
+
+    FILE* f = _wfopen(wpath.c_str(), L"rb");
+    if (!f) return nullptr;
+    vector<uint8_t> data;
+    uint8_t chunk[65536];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        data.insert(data.end(), chunk, chunk + got);
+    fclose(f);
+
+    vector<float> mono;
+    uint32_t rate = 0;
+    if (!decodeWav(data.data(), data.size(), mono, rate)) return nullptr;
+    vector<float> resampled = resampleToMixRate(mono, rate);
+
+    if (!known) {
+        level = loudnessGain(resampled.data(), resampled.size());
+        saveCachedGain(key, size, writeTime, level);
     }
+    for (float& v : resampled) v *= 32767.0f;
+
+    auto pcm = make_shared<vector<int16_t>>(resampled.size());
+    for (size_t i = 0; i < resampled.size(); i += MIX_BLOCK)
+        mixStore(pcm->data() + i, resampled.data() + i,
+                 static_cast<int>(min<size_t>(MIX_BLOCK, resampled.size() - i)));
+    cachedPath = path;
+    cachedSize = size;
+    cachedTime = writeTime;
+    cached     = pcm;
+    cachedGain = level;
+    if (gain) *gain = cachedGain;
+    return cached;
 }
 
-// Wertet --macro-Unterbefehle aus und kehrt sofort zurück.
-// Rückgabe: 0 oder 1 (Exitcode) wenn --macro gefunden wurde; -1 wenn nicht.
-static int handleMacroCommands(vector<string>& args) {
-    const int n = static_cast<int>(args.size());
-    for (int i = 0; i < n; ++i) {
-        if (args[i] != "--macro") continue;
+// ── Audio-Ausgabe (Sinks) ─────────────────────────────────────────────
+// Der Mixer schreibt seine Blöcke in einen austauschbaren Sink (--audio-backend):
+//   winmm     waveOut-Geraet (Standard; läuft seit Vista ohnehin über WASAPI Shared Mode)
+//   null      verwirft alles, taktet aber in Echtzeit (wie ein echtes Geraet)
+//   wav:<Datei>  schreibt den gemischten Strom in eine WAV-Datei, ebenfalls in Echtzeit
+//             getaktet, damit Sample-Position und Timer-Zeit übereinstimmen. Daneben
+//             entsteht "<Datei>.txt" mit Markierungen (Sample-Index, Ereignis), z. B.
+//             "deadline" – so lässt sich ohne Lautsprecher pruefen, ob die Voralarm-Beeps
+//             exakt auf den Sekundengrenzen vor Ablauf liegen.
+enum class AudioBackend { Winmm, Null, WavFile };
+
+class AudioSink {
+public:
+    virtual ~AudioSink() = default;
+    virtual bool open() = 0;   // synchron; false = Geraet/Datei nicht verfügbar
+    virtual void close() = 0;
+    // Liefert den nächsten freien Block (MIX_BLOCK Samples) oder nullptr nach Timeout.
+    virtual int16_t* acquire(int timeoutMs) = 0;
+    virtual void submit(int16_t* block) = 0;
+    virtual void wake() = 0;   // weckt ein wartendes acquire() (Beenden)
+    // Ereignis-Markierung zum Zeitpunkt 'when'; nur der Datei-Sink wertet sie aus.
+    virtual void mark(const char* /*label*/, chrono::steady_clock::time_point /*when*/) {}
+    // Darf der Mixer den Sink nach MIX_IDLE_CLOSE_SEC Leerlauf schliessen?
+    virtual bool closesWhenIdle() const { return true; }
+    // Seit open() tatsächlich ausgegebene Samples (für --calibrate-audio).
+    virtual long long playedSamples() = 0;
+};
 
-        if (i + 1 >= n) {
-            cout << t(Str::MACRO_MISSING_SUBCMD) << "\n";
-            return 1;
+class WinmmSink : public AudioSink {
+public:
+    bool open() override {
+        if (!hEvent) hEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!hEvent) return false;
+        WAVEFORMATEX fmt{};
+        fmt.wFormatTag      = WAVE_FORMAT_PCM;
+        fmt.nChannels       = 1;
+        fmt.nSamplesPerSec  = MIX_RATE;
+        fmt.wBitsPerSample  = 16;
+        fmt.nBlockAlign     = 2;
+        fmt.nAvgBytesPerSec = MIX_RATE * 2;
+        if (waveOutOpen(&hwo, WAVE_MAPPER, &fmt, reinterpret_cast<uintptr_t>(hEvent),
+                        0, CALLBACK_EVENT) != MMSYSERR_NOERROR) {
+            hwo = nullptr;
+            return false;
+        }
+        for (int b = 0; b < MIX_BUFFERS; ++b) {
+            hdr[b] = WAVEHDR{};
+            hdr[b].lpData         = reinterpret_cast<char*>(buf[b]);
+            hdr[b].dwBufferLength = sizeof(buf[b]);
+            waveOutPrepareHeader(hwo, &hdr[b], sizeof(WAVEHDR));
+            hdr[b].dwFlags |= WHDR_DONE; // als "frei" markieren, damit sofort gefüllt wird
         }
+        return true;
+    }
 
-        string subcmd = args[i + 1];
-        char   buf[256];
+    void close() override {
+        if (!hwo) return;
+        waveOutReset(hwo);
+        for (int b = 0; b < MIX_BUFFERS; ++b)
+            waveOutUnprepareHeader(hwo, &hdr[b], sizeof(WAVEHDR));
+        waveOutClose(hwo);
+        hwo = nullptr;
+    }
 
-        if (!isMacroSubCmdValid(subcmd)) {
-            snprintf(buf, sizeof(buf), t(Str::MACRO_INVALID_SUBCMD), subcmd.c_str());
-            cout << buf << "\n";
-            return 1;
+    int16_t* acquire(int timeoutMs) override {
+        for (int pass = 0; pass < 2; ++pass) {
+            for (int b = 0; b < MIX_BUFFERS; ++b)
+                if (hdr[b].dwFlags & WHDR_DONE) return buf[b];
+            if (pass == 0) WaitForSingleObject(hEvent, static_cast<DWORD>(timeoutMs));
         }
+        return nullptr;
+    }
 
-        // ── list ──────────────────────────────────────────────────────
-        if (subcmd == "list") {
-            auto macros = loadMacros();
-            if (macros.empty()) {
-                cout << t(Str::MACRO_LIST_EMPTY) << "\n";
-            } else {
-                cout << t(Str::MACRO_LIST_HEADER) << "\n";
-                for (const auto& kv : macros)
-                    cout << "  " << kv.first << " = " << kv.second << "\n";
-            }
-            return 0;
+    void submit(int16_t* block) override {
+        int b = static_cast<int>((block - buf[0]) / MIX_BLOCK);
+        hdr[b].dwFlags &= ~WHDR_DONE;
+        waveOutWrite(hwo, &hdr[b], sizeof(WAVEHDR));
+    }
+
+    void wake() override { if (hEvent) SetEvent(hEvent); }
+
+    long long playedSamples() override {
+        MMTIME t{};
+        t.wType = TIME_SAMPLES;
+        if (!hwo || waveOutGetPosition(hwo, &t, sizeof(t)) != MMSYSERR_NOERROR) return 0;
+        if (t.wType == TIME_BYTES) return t.u.cb / 2; // Treiber kennt nur Bytes
+        return t.wType == TIME_SAMPLES ? t.u.sample : 0;
+    }
+
+private:
+    HWAVEOUT hwo    = nullptr;
+    HANDLE   hEvent = nullptr;
+    WAVEHDR  hdr[MIX_BUFFERS]{};
+    int16_t  buf[MIX_BUFFERS][MIX_BLOCK]{};
+};
+
+// Gemeinsame Echtzeit-Taktung für Sinks ohne Geraet: Block k wird zum Zeitpunkt
+// t0 + k * 20 ms angefordert, genau wie ein Geraet ihn abrufen würde.
+class PacedSink : public AudioSink {
+public:
+    bool open() override {
+        t0 = chrono::steady_clock::now();
+        blocks = 0;
+        return true;
+    }
+    void close() override {}
+
+    int16_t* acquire(int timeoutMs) override {
+        auto due = t0 + chrono::microseconds(blocks * 1000000LL * MIX_BLOCK / MIX_RATE);
+        auto limit = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+        unique_lock<mutex> lk(wakeMtx);
+        if (wakeCv.wait_until(lk, min(due, limit), [&]{ return woken; })) {
+            woken = false;
+            return nullptr;
         }
+        if (chrono::steady_clock::now() < due) return nullptr;
+        return block;
+    }
 
-        // ── remove ────────────────────────────────────────────────────
-        if (subcmd == "remove") {
-            if (i + 2 >= n) { cout << t(Str::MACRO_MISSING_NAME) << "\n"; return 1; }
-            string name = args[i + 2];
-            if (removeMacroFromIni(name)) {
-                snprintf(buf, sizeof(buf), t(Str::MACRO_REMOVED), name.c_str());
-                cout << buf << "\n";
-                return 0;
-            } else {
-                snprintf(buf, sizeof(buf), t(Str::MACRO_NOT_FOUND), name.c_str());
-                cout << buf << "\n";
-                return 1;
-            }
+    void submit(int16_t* data) override {
+        consume(data);
+        ++blocks;
+    }
+
+    void wake() override {
+        lock_guard<mutex> lk(wakeMtx);
+        woken = true;
+        wakeCv.notify_all();
+    }
+
+    // Ohne Geraet gilt ein Block als ausgegeben, sobald seine Zeit verstrichen ist.
+    long long playedSamples() override {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - t0).count()
+               * MIX_RATE / 1000000LL;
+    }
+
+protected:
+    virtual void consume(const int16_t* /*data*/) {}
+
+    chrono::steady_clock::time_point t0;
+    long long          blocks = 0;
+    int16_t            block[MIX_BLOCK]{};
+    mutex              wakeMtx;
+    condition_variable wakeCv;
+    bool               woken = false;
+};
+
+class NullSink : public PacedSink {};
+
+class WavFileSink : public PacedSink {
+public:
+    explicit WavFileSink(wstring path) : path(std::move(path)) {}
+
+    bool open() override {
+        f = _wfopen(path.c_str(), L"wb");
+        if (!f) return false;
+        markers = _wfopen((path + L".txt").c_str(), L"w");
+        uint8_t header[44]{}; // Größenfelder werden in close() nachgetragen
+        fwrite(header, 1, sizeof(header), f);
+        dataBytes = 0;
+        full      = false;
+        PacedSink::open();
+        if (markers) {
+            time_t wall = time(nullptr);
+            tm local{};
+            char tbuf[32] = "?";
+            if (localtime_s(&local, &wall) == 0)
+                strftime(tbuf, sizeof(tbuf), "%Y-%m-%d %H:%M:%S", &local);
+            fprintf(markers, "# teefax audio log: rate=%u start=%s\n# sample\tevent\n", MIX_RATE, tbuf);
         }
+        return true;
+    }
 
-        // ── add ───────────────────────────────────────────────────────
-        if (subcmd == "add") {
-            if (i + 2 >= n) { cout << t(Str::MACRO_MISSING_NAME) << "\n"; return 1; }
-            string name = args[i + 2];
+    void close() override {
+        if (!f) return;
+        auto w16 = [&](long o, uint16_t v){ fseek(f, o, SEEK_SET); fwrite(&v, 2, 1, f); };
+        auto w32 = [&](long o, uint32_t v){ fseek(f, o, SEEK_SET); fwrite(&v, 4, 1, f); };
+        fseek(f, 0, SEEK_SET);  fwrite("RIFF", 1, 4, f); w32(4, 36 + dataBytes);
+        fseek(f, 8, SEEK_SET);  fwrite("WAVEfmt ", 1, 8, f); w32(16, 16);
+        w16(20, 1); w16(22, 1); w32(24, MIX_RATE); w32(28, MIX_RATE * 2); w16(32, 2); w16(34, 16);
+        fseek(f, 36, SEEK_SET); fwrite("data", 1, 4, f); w32(40, dataBytes);
+        fclose(f);
+        f = nullptr;
+        if (markers) { fclose(markers); markers = nullptr; }
+    }
 
-            if (!isMacroNameValid(name)) {
-                snprintf(buf, sizeof(buf), t(Str::MACRO_INVALID_NAME), name.c_str());
-                cout << buf << "\n"; return 1;
-            }
-            if (isMacroNameReserved(name)) {
-                snprintf(buf, sizeof(buf), t(Str::MACRO_NAME_RESERVED), name.c_str());
-                cout << buf << "\n"; return 1;
-            }
-            if (i + 3 >= n) { cout << t(Str::MACRO_MISSING_ARGS) << "\n"; return 1; }
+    void mark(const char* label, chrono::steady_clock::time_point when) override {
+        lock_guard<mutex> lk(markMtx);
+        if (!markers) return;
+        long long sample = chrono::duration_cast<chrono::microseconds>(when - t0).count()
+                           * MIX_RATE / 1000000LL;
+        fprintf(markers, "%lld\t%s\n", sample, label);
+        fflush(markers);
+    }
 
-            // Alle verbleibenden Token als Makro-Body zusammenfügen.
-            // Quoting-Regeln: Token mit Leerzeichen -> quoten (schuetzt mehrwortige Werte
-            // beim spaeteren Wiedereinlesen durch tokenizeConfigLine). Zusaetzlich wird der
-            // Wert eines Freitext-Schalters vorsorglich quotiert, selbst ohne Leerzeichen,
-            // damit ein Wert, der zufaellig mit '-' beginnt, beim Wiedereinlesen nicht als
-            // eigener Schalter fehlgedeutet wird.
-            //
-            // Absichtlich NUR die vier echten Freitext-Schalter, deren Wert grundsaetzlich
-            // beliebigen Text enthalten kann (Fensertitel, Dateipfad, Konsolenbefehl):
-            // --focus, --sound, --open, --cmd. Alle uebrigen Wert-Schalter (--at, --daily,
-            // --every, --alarm-repeat, --alarm-interval, --prealarm, --lang, --loop) nehmen
-            // ausschliesslich strukturierte Werte entgegen - Zahlen, Uhrzeiten, Datumsangaben,
-            // Sprachcodes -, die niemals ein Leerzeichen enthalten und daher nie eine
-            // Quotierung benoetigen. Wuerden sie dennoch in diese Liste aufgenommen, entstuende
-            // derselbe Fehler wie zuvor bei --loop: Schalter mit MEHREREN nachfolgenden Werten
-            // (--daily nimmt beliebig viele Uhrzeiten, --every und --at je bis zu zwei) erhielten
-            // nur beim ERSTEN Wert faelschlich Anfuehrungszeichen, waehrend die uebrigen
-            // unquotiert blieben - ein irrefuehrendes, asymmetrisches Bild in der teefax.ini.
-            static const vector<string> valueFlags = {
-                "--focus", "-f", "--sound", "-s", "--open", "-o", "--cmd", "-c",
-            };
-            string macroArgs;
-            bool nextNeedsQuotes = false;
-            for (int j = i + 3; j < n; ++j) {
-                if (j > i + 3) macroArgs += " ";
-                const string& tok = args[j];
-                bool needsQuotes = nextNeedsQuotes || tok.find(' ') != string::npos;
-                nextNeedsQuotes = false;
-                for (const auto& vf : valueFlags)
-                    if (tok == vf) { nextNeedsQuotes = true; break; }
-                if (needsQuotes) macroArgs += '"';
-                macroArgs += tok;
-                if (needsQuotes) macroArgs += '"';
+    // Die Datei laeuft lückenlos durch: ein erneutes open() würde sie überschreiben
+    // und die Sample-Zählung neu beginnen.
+    bool closesWhenIdle() const override { return false; }
+
+protected:
+    void consume(const int16_t* data) override {
+        // Die RIFF-Größenfelder sind 32 Bit breit (bei 22,05 kHz/16 Bit mono ~27 h):
+        // an der Grenze endet die Aufnahme, der Sink taktet aber weiter.
+        constexpr uint32_t block = MIX_BLOCK * sizeof(int16_t);
+        if (dataBytes > MAX_DATA_BYTES - block) {
+            if (!full) {
+                full = true;
+                mark("wav-limit", chrono::steady_clock::now());
             }
+            return;
+        }
+        fwrite(data, sizeof(int16_t), MIX_BLOCK, f);
+        dataBytes += block;
+    }
 
-            // Rückfrage wenn Makro bereits existiert
-            auto macros = loadMacros();
-            if (macros.count(name)) {
-                snprintf(buf, sizeof(buf), t(Str::MACRO_OVERWRITE_PROMPT), name.c_str());
-                cout << buf << flush;
-                if (g_consoleModeChanged)
-                    SetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), g_originalConsoleMode);
-                string answer;
-                getline(cin, answer);
-                if (g_consoleModeChanged) {
-                    HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
-                    DWORD  mode = 0;
-                    if (GetConsoleMode(hIn, &mode)) {
-                        mode &= ~ENABLE_QUICK_EDIT_MODE;
-                        mode |=  ENABLE_EXTENDED_FLAGS;
-                        SetConsoleMode(hIn, mode);
-                    }
+private:
+    wstring  path;
+    FILE*    f       = nullptr;
+    FILE*    markers = nullptr;
+    mutex    markMtx;
+    uint32_t dataBytes = 0;
+    bool     full      = false; // nur Audio-Thread
+
+    static constexpr uint32_t MAX_DATA_BYTES = 0xFFFFFFFFu - 36; // RIFF-Größe = 36 + Daten
+};
+
+// Stimme, deren Samples erst beim Mischen entstehen (endlose oder sehr lange Spuren,
+// z. B. das Metronom). render() läuft auf dem Audio-Thread und darf nicht blockieren.
+class VoiceGenerator {
+public:
+    virtual ~VoiceGenerator() = default;
+    // Addiert die nächsten 'n' Samples mit Pegel 'gain' auf 'acc'.
+    // Rückgabe: false, wenn die Stimme zu Ende ist.
+    virtual bool render(float* acc, int n, float gain) = 0;
+};
+
+using GeneratorPtr = shared_ptr<VoiceGenerator>;
+
+// Begrenzte, sperrfreie Befehlswarteschlange (Vyukov, mehrere Schreiber, ein Leser).
+// push()/pop() sind O(1) und allokieren nicht; ist die Schlange voll, liefert push() false.
+template <typename T, size_t N>
+class CommandQueue {
+    static_assert((N & (N - 1)) == 0, "N muss eine Zweierpotenz sein");
+public:
+    CommandQueue() {
+        for (size_t i = 0; i < N; ++i) cells[i].seq.store(i, memory_order_relaxed);
+    }
+
+    bool push(const T& v) {
+        size_t pos = tail.load(memory_order_relaxed);
+        for (;;) {
+            Cell& c = cells[pos & (N - 1)];
+            size_t seq = c.seq.load(memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    c.value = v;
+                    c.seq.store(pos + 1, memory_order_release);
+                    return true;
                 }
-                string yesChars = t(Str::MACRO_OVERWRITE_YES);
-                if (answer.empty() || yesChars.find(answer[0]) == string::npos)
-                    return 0;
+            } else if (diff < 0) {
+                return false; // voll
+            } else {
+                pos = tail.load(memory_order_relaxed);
             }
-            saveMacroToIni(name, macroArgs);
-            snprintf(buf, sizeof(buf), t(Str::MACRO_ADDED), name.c_str());
-            cout << buf << "\n";
-            return 0;
         }
     }
-    return -1; // kein --macro gefunden
-}
 
-// Ersetzt den ersten passenden CLI-Makronamen durch seine gespeicherten Tokens.
-// Nur CLI-Argumente werden geprüft (ab cliStart), damit INI-Tokens nicht
-// versehentlich als Makronamen ausgewertet werden.
-static void expandMacroInArgs(vector<string>& args, int argc) {
-    auto macros = loadMacros();
-    int cliStart = static_cast<int>(args.size()) - (argc - 1);
-    if (cliStart < 0) cliStart = 0;
+    bool pop(T& out) {
+        size_t pos = head.load(memory_order_relaxed);
+        Cell& c = cells[pos & (N - 1)];
+        if (static_cast<intptr_t>(c.seq.load(memory_order_acquire)) - static_cast<intptr_t>(pos + 1) < 0)
+            return false; // leer
+        head.store(pos + 1, memory_order_relaxed);
+        out = std::move(c.value);
+        c.value = T{};
+        c.seq.store(pos + N, memory_order_release);
+        return true;
+    }
 
-    // Flags, deren naechstes Token ein freier Wert ist (kein Makroname)
-    static const vector<string> valueFlags = {
-        "--sound",         "-s",       "--cmd",    "-c",       "--open",   "-o",
-        "--focus",         "-f",       "--at",     "-a",   "--until",
-        "--lang",          "-la",      "--for",
-        "--alarm-repeat",  "-ar",      "--alarm-interval", "-ai",
-        "--prealarm",      "-pa",      "--loop",   "-l",
-        "--every",         "-e",       "--daily",  "-d"
-    };
+private:
+    struct Cell { atomic<size_t> seq; T value; };
+    Cell           cells[N];
+    atomic<size_t> tail{0};
+    atomic<size_t> head{0};
+};
 
-    bool skipNext = false;
-    for (int i = cliStart; i < static_cast<int>(args.size()); ++i) {
-        const string& a = args[i];
-        if (skipNext) { skipNext = false; continue; }
-        if (a[0] == '-') {
-            for (const auto& vf : valueFlags)
-                if (a == vf) { skipNext = true; break; }
-            continue;
-        }
-        auto it = macros.find(a);
-        if (it != macros.end()) {
-            vector<string> expanded = tokenizeConfigLine(it->second);
-            args.erase(args.begin() + i);
-            args.insert(args.begin() + i, expanded.begin(), expanded.end());
-            break; // nur einmal expandieren
-        }
+// Der Mixer läuft als ein einziger, langlebiger Audio-Thread. Nur er berührt die
+// Audio-API (Sink öffnen, schreiben, schliessen). Alle anderen Threads schicken
+// Befehle (Wiedergabe, Stopp, Keepalive, Markierung) über die sperrfreie
+// Warteschlange und kehren sofort zurück; das Geraet bleibt über Schleifendurchläufe
+// hinweg offen, bis MIX_IDLE_CLOSE_SEC Leerlauf verstrichen sind.
+class AudioMixer {
+public:
+    static AudioMixer& instance() { static AudioMixer m; return m; }
+
+    // Sink festlegen (vor startWorker(); ohne Aufruf gilt winmm).
+    void setSink(unique_ptr<AudioSink> s, AudioBackend kind) {
+        sink    = std::move(s);
+        backend = kind;
     }
-}
 
-// Deaktiviert QuickEdit, sofern ein Timer gestartet wird.
-// Ausgenommen: --help, --version und Aufrufe ohne Argumente.
-static void setupQuickEdit(const vector<string>& args, int argc) {
-    if (argc < 2) return;
-    for (const auto& a : args)
-        if (a == "--help" || a == "-h" || a == "--version" || a == "-v") return;
+    AudioBackend backendKind() const { return backend; }
 
-    HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
-    DWORD  mode = 0;
-    if (GetConsoleMode(hIn, &mode)) {
-        g_originalConsoleMode = mode;
-        g_consoleModeChanged  = true;
-        mode &= ~ENABLE_QUICK_EDIT_MODE;
-        mode |=  ENABLE_EXTENDED_FLAGS;
-        SetConsoleMode(hIn, mode);
+    // Startet den Audio-Thread (einmalig). Das Geraet wird erst bei Bedarf geöffnet.
+    void startWorker() {
+        if (worker.joinable()) return;
+        if (!sink) sink = make_unique<WinmmSink>();
+        wakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        workerAlive.store(true);
+        worker = thread([this]{ threadMain(); });
     }
-}
 
-// ═══════════════════════════════════════════════════════════════════════════
-// ── Argument-Parser ────────────────────────────────────────────────────────
-// ═══════════════════════════════════════════════════════════════════════════
+    // Öffnet das Geraet und wartet auf das Ergebnis (Vorwärmung, Kalibrierung):
+    // so fällt die Öffnungszeit nicht in einen Beep.
+    bool open()  { return request(Cmd::Open); }
+    // Schliesst das Geraet sofort (Kalibrierung misst jedes Mal ein frisches Öffnen).
+    void close() { request(Cmd::Close); }
+
+    // Beendet den Audio-Thread und schließt den Sink (Programmende).
+    void shutdown() {
+        if (!worker.joinable()) return;
+        post(Command(Cmd::Quit));
+        if (deviceOpen.load()) sink->wake();
+        worker.join();
+        CloseHandle(wakeEvent);
+        wakeEvent = nullptr;
+    }
 
-// Parst die kombinierte Argumentliste (INI + CLI) in cfg.
-// Rückgabe: -1 = Timer starten; 0 = Exit OK; 1 = Exit Fehler.
-static int parseArguments(const vector<string>& args, TimerConfig& cfg) {
-    const int nArgs = static_cast<int>(args.size());
-    bool timeTokenSeen = false; // true, sobald ein Argument als Zeit akzeptiert wurde
+    // Neue Stimme; Rückgabe: Stimmen-ID (> 0) oder 0, wenn sie nicht eingereiht werden konnte.
+    int play(PcmPtr pcm, float gain = 1.0f, bool loop = false) {
+        if (!pcm || pcm->empty() || !workerAlive.load()) return 0;
+        int id = nextId.fetch_add(1);
+        Command c{Cmd::Play};
+        c.id = id; c.pcm = std::move(pcm); c.gain = gain; c.flag = loop;
+        return post(c) ? id : 0;
+    }
 
-    for (int i = 0; i < nArgs; ++i) {
-        const string& arg = args[i];
+    // Generator-Stimme (läuft, bis render() false liefert oder stop() kommt).
+    int play(GeneratorPtr gen, float gain = 1.0f) {
+        if (!gen || !workerAlive.load()) return 0;
+        int id = nextId.fetch_add(1);
+        Command c{Cmd::Play};
+        c.id = id; c.gen = std::move(gen); c.gain = gain;
+        return post(c) ? id : 0;
+    }
 
-        if (arg == "--nosleep" || arg == "-ns") {
-            cfg.noSleep = true;
+    void stop(int id) {
+        Command c{Cmd::Stop};
+        c.id = id;
+        post(c);
+    }
 
-        } else if (arg == "--eco") {
-            cfg.eco = true;
+    // Blockiert, bis die Stimme ausgemischt oder gestoppt ist (synchrone Wiedergabe).
+    void wait(int id) {
+        unique_lock<mutex> lk(doneMtx);
+        doneCv.wait(lk, [&]{
+            return !workerAlive.load() || find(finished, finished + FINISHED_RING, id) != finished + FINISHED_RING;
+        });
+    }
 
-        } else if (arg == "--mute" || arg == "-m") {
-            cfg.mute = true;
+    // Nicht blockierend: ist die Stimme bereits ausgemischt oder gestoppt?
+    bool finishedVoice(int id) {
+        lock_guard<mutex> lk(doneMtx);
+        return !workerAlive.load() || find(finished, finished + FINISHED_RING, id) != finished + FINISHED_RING;
+    }
 
-        } else if (arg == "--loop" || arg == "-l") {
-            cfg.loop = true;
-            if (i + 1 < nArgs) {
-                int possibleCount = safeStoi(args[i + 1], -1);
-                if (possibleCount > 0) { cfg.maxLoops = possibleCount; ++i; }
-            }
+    // Gesetzt, sobald eine Stimme endet; zusammen mit Tasten abwartbar
+    // (ConsoleInput::waitKey), danach finishedVoice() prüfen.
+    HANDLE finishedSignal() const { return doneEvent; }
 
-        } else if (arg == "--nomsg") {
-            cfg.showMessage = false;
+    // Keepalive: Geraet bleibt offen und spielt Stille, auch ohne Stimmen.
+    void setKeepAlive(bool on) {
+        Command c{Cmd::KeepAlive};
+        c.flag = on;
+        post(c);
+    }
+
+    // Ereignis im Ausgabestrom markieren; 'label' muss ein String-Literal sein.
+    void mark(const char* label) {
+        Command c{Cmd::Mark};
+        c.label = label;
+        c.when  = chrono::steady_clock::now();
+        post(c);
+    }
+
+    // Letzter Öffnungsversuch gescheitert? (Aufrufer weichen dann auf PlaySound aus)
+    bool deviceFailed() const { return openFailed.load(); }
+
+    // An den Sink übergebene bzw. von ihm ausgegebene Samples seit dem Öffnen.
+    long long submittedSamples() const { return submitted.load(); }
+    long long playedSamples() { return deviceOpen.load() ? sink->playedSamples() : 0; }
+
+private:
+    enum class Cmd { None, Play, Stop, KeepAlive, Mark, Open, Close, Quit };
+
+    struct Command {
+        Command(Cmd t = Cmd::None) : type(t) {}
+        Cmd    type;
+        int    id   = 0;
+        PcmPtr pcm;
+        GeneratorPtr gen;
+        float  gain = 1.0f;
+        bool   flag = false; // Play: Schleife; KeepAlive: an/aus
+        const char* label = nullptr;
+        chrono::steady_clock::time_point when;
+    };
+
+    struct Voice {
+        int          id;
+        PcmPtr       pcm;  // entweder fertige Samples ...
+        GeneratorPtr gen;  // ... oder ein Generator
+        size_t       pos;
+        float        gain;
+        bool         loop;
+        bool         ended;
+    };
+
+    static constexpr int FINISHED_RING = 64;
+
+    AudioMixer() : doneEvent(CreateEventW(nullptr, FALSE, FALSE, nullptr)) {}
+    ~AudioMixer() { shutdown(); }
+
+    bool post(const Command& c) {
+        if (!queue.push(c)) return false;
+        if (wakeEvent) SetEvent(wakeEvent);
+        return true;
+    }
+
+    // Befehl einreihen und auf die Quittung des Audio-Threads warten.
+    bool request(Cmd type) {
+        if (!workerAlive.load()) return false;
+        uint64_t ticket;
+        {
+            lock_guard<mutex> lk(doneMtx);
+            ticket = ++requestSeq;
+        }
+        Command c{type};
+        c.id = static_cast<int>(ticket);
+        if (!post(c)) return false;
+        unique_lock<mutex> lk(doneMtx);
+        doneCv.wait(lk, [&]{ return !workerAlive.load() || ackedSeq >= ticket; });
+        return ackedSeq >= ticket && lastAckOk;
+    }
+
+    void acknowledge(int ticket, bool ok) {
+        {
+            lock_guard<mutex> lk(doneMtx);
+            ackedSeq  = static_cast<uint64_t>(ticket);
+            lastAckOk = ok;
+        }
+        doneCv.notify_all();
+    }
+
+    void finish(int id) {
+        {
+            lock_guard<mutex> lk(doneMtx);
+            finished[finishedPos++ % FINISHED_RING] = id;
+        }
+        doneCv.notify_all();
+        SetEvent(doneEvent);
+    }
+
+    // --- Ab hier nur auf dem Audio-Thread ---
+
+    bool openDevice() {
+        if (deviceOpen.load()) return true;
+        if (!sink->open()) {
+            openFailed.store(true);
+            return false;
+        }
+        openFailed.store(false);
+        submitted.store(0);
+        deviceOpen.store(true);
+        lastActive = chrono::steady_clock::now();
+        return true;
+    }
+
+    void closeDevice() {
+        if (!deviceOpen.load()) return;
+        deviceOpen.store(false);
+        sink->close();
+        for (const auto& v : voices) finish(v.id);
+        voices.clear();
+    }
+
+    // Rückgabe: false bei Quit.
+    bool drainCommands() {
+        Command c;
+        while (queue.pop(c)) {
+            switch (c.type) {
+            case Cmd::Play:
+                if (openDevice()) voices.push_back({c.id, std::move(c.pcm), std::move(c.gen), 0, c.gain, c.flag, false});
+                else              finish(c.id);
+                break;
+            case Cmd::Stop: {
+                auto it = find_if(voices.begin(), voices.end(), [&](const Voice& v){ return v.id == c.id; });
+                if (it != voices.end()) { voices.erase(it); finish(c.id); }
+                break;
+            }
+            case Cmd::KeepAlive:
+                keepAlive = c.flag;
+                if (keepAlive) openDevice();
+                break;
+            case Cmd::Mark:
+                if (deviceOpen.load()) sink->mark(c.label, c.when);
+                break;
+            case Cmd::Open:
+                acknowledge(c.id, openDevice());
+                break;
+            case Cmd::Close:
+                closeDevice();
+                acknowledge(c.id, true);
+                break;
+            case Cmd::Quit:
+                return false;
+            case Cmd::None:
+                break;
+            }
+        }
+        return true;
+    }
+
+    // Mischt einen Block aller aktiven Stimmen; beendete Stimmen werden entfernt.
+    // Rückgabe: true, wenn mindestens eine Stimme beigetragen hat.
+    bool mixBlock(int16_t* out) {
+        fill(acc, acc + MIX_BLOCK, 0.0f);
+        bool any = !voices.empty();
+        for (auto& v : voices) {
+            if (v.gen) {
+                v.ended = !v.gen->render(acc, MIX_BLOCK, v.gain);
+                continue;
+            }
+            const auto& s = *v.pcm;
+            int done = 0;
+            while (done < MIX_BLOCK && v.pos < s.size()) {
+                int n = static_cast<int>(min<size_t>(MIX_BLOCK - done, s.size() - v.pos));
+                mixAccumulate(acc + done, s.data() + v.pos, n, v.gain);
+                v.pos += n; done += n;
+                if (v.pos >= s.size() && v.loop) v.pos = 0;
+            }
+            v.ended = v.pos >= s.size();
+        }
+        for (auto it = voices.begin(); it != voices.end();) {
+            if (it->ended) { finish(it->id); it = voices.erase(it); }
+            else ++it;
+        }
+        mixStore(out, acc, MIX_BLOCK);
+        return any;
+    }
+
+    void threadMain() {
+        // Audio hat Vorrang vor allem anderen, schläft aber fast immer im Sink.
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+        voices.reserve(16);
+        while (drainCommands()) {
+            if (!deviceOpen.load()) {
+                WaitForSingleObject(wakeEvent, INFINITE); // Geraet zu: nur auf Befehle warten
+                continue;
+            }
+            // Kurzer Timeout, damit neue Befehle spätestens nach einem Block greifen.
+            if (int16_t* block = sink->acquire(MIX_BLOCK * 1000 / MIX_RATE)) {
+                if (mixBlock(block) || keepAlive)
+                    lastActive = chrono::steady_clock::now();
+                sink->submit(block);
+                submitted.fetch_add(MIX_BLOCK);
+            }
+            if (sink->closesWhenIdle() && voices.empty() && !keepAlive &&
+                chrono::steady_clock::now() - lastActive > chrono::seconds(MIX_IDLE_CLOSE_SEC))
+                closeDevice();
+        }
+        closeDevice();
+        workerAlive.store(false);
+        { lock_guard<mutex> lk(doneMtx); }
+        doneCv.notify_all();
+        SetEvent(doneEvent);
+    }
+
+    CommandQueue<Command, 64> queue;
+    HANDLE                wakeEvent = nullptr;
+    thread                worker;
+    atomic<bool>          workerAlive{false};
+    atomic<int>           nextId{1};
+    unique_ptr<AudioSink> sink;
+    AudioBackend          backend = AudioBackend::Winmm;
+
+    // Quittungen und beendete Stimmen (nur für blockierende Aufrufer)
+    mutex                 doneMtx;
+    condition_variable    doneCv;
+    int                   finished[FINISHED_RING]{};
+    HANDLE                doneEvent = nullptr; // Auto-Reset, siehe finishedSignal()
+    unsigned              finishedPos = 0;
+    uint64_t              requestSeq  = 0;
+    uint64_t              ackedSeq    = 0;
+    bool                  lastAckOk   = false;
+
+    // Zustand des Audio-Threads
+    vector<Voice>         voices;
+    bool                  keepAlive = false;
+    chrono::steady_clock::time_point lastActive;
+    atomic<bool>          deviceOpen{false};
+    atomic<bool>          openFailed{false};
+    atomic<long long>     submitted{0};
+    float                 acc[MIX_BLOCK]{};
+};
+
+// ── Eingebaute Klänge (--tone) ──────────────────────────────────────────────
+// Statt eines eingebetteten PCM-Arrays werden die Alarmtöne beim ersten Gebrauch
+// aus wenigen Parametern synthetisiert: jede Note ist eine Summe gedämpfter
+// Sinus-Teiltöne (additive Synthese, exponentieller Abfall, kurzer Einschwinger).
+
+struct TonePartial {
+    float ratio;   // Frequenz relativ zum Grundton (nicht ganzzahlig = glockenartig)
+    float amp;     // relative Amplitude
+    float decay;   // Zeitkonstante des Abklingens in Sekunden
+};
+
+struct ToneNote {
+    float start;   // Einsatz in Sekunden
+    float freq;    // Grundfrequenz in Hz
+    float length;  // Dauer in Sekunden (danach kurzes Ausblenden)
+};
+
+struct ToneDef {
+    const char*          name;
+    const TonePartial*   partials;
+    int                  partialCount;
+    const ToneNote*      notes;
+    int                  noteCount;
+    float                gain;    // Spitzenpegel nach Normalisierung (0..1)
+};
+
+// Glockenspiel: drei aufsteigende Töne (E6, G6, C7) mit hellem Nachklang
+static const TonePartial CHIME_PARTIALS[] = {
+    { 1.00f, 1.00f, 0.45f }, { 2.76f, 0.35f, 0.20f }, { 5.40f, 0.12f, 0.10f },
+};
+static const ToneNote CHIME_NOTES[] = {
+    { 0.00f, 1318.5f, 0.55f }, { 0.16f, 1568.0f, 0.55f }, { 0.32f, 2093.0f, 0.80f },
+};
+
+// Piepmuster: zweimal vier kurze Rechteck-ähnliche Pieps (ungerade Obertöne)
+static const TonePartial BEEP_PARTIALS[] = {
+    { 1.00f, 1.00f, 10.0f }, { 3.00f, 0.30f, 10.0f }, { 5.00f, 0.12f, 10.0f },
+};
+static const ToneNote BEEP_NOTES[] = {
+    { 0.00f, 1000.0f, 0.07f }, { 0.12f, 1000.0f, 0.07f }, { 0.24f, 1000.0f, 0.07f }, { 0.36f, 1000.0f, 0.07f },
+    { 0.70f, 1000.0f, 0.07f }, { 0.82f, 1000.0f, 0.07f }, { 0.94f, 1000.0f, 0.07f }, { 1.06f, 1000.0f, 0.07f },
+};
+
+// Gong: tiefer Grundton mit unharmonischen, unterschiedlich schnell abklingenden Teiltönen
+static const TonePartial GONG_PARTIALS[] = {
+    { 1.00f, 1.00f, 1.60f }, { 1.48f, 0.60f, 1.10f }, { 2.15f, 0.45f, 0.80f },
+    { 2.92f, 0.30f, 0.55f }, { 4.07f, 0.18f, 0.35f },
+};
+static const ToneNote GONG_NOTES[] = {
+    { 0.00f, 130.8f, 3.00f },
+};
+
+#define TONE_DEF(n, p, s, g) { n, p, static_cast<int>(size(p)), s, static_cast<int>(size(s)), g }
+static const ToneDef TONES[] = {
+    TONE_DEF("chime", CHIME_PARTIALS, CHIME_NOTES, 0.70f),
+    TONE_DEF("beep",  BEEP_PARTIALS,  BEEP_NOTES,  0.50f),
+    TONE_DEF("gong",  GONG_PARTIALS,  GONG_NOTES,  0.80f),
+};
+#undef TONE_DEF
+
+static const ToneDef* findTone(const string& name) {
+    for (const auto& def : TONES)
+        if (name == def.name) return &def;
+    return nullptr;
+}
+
+// Prüft einen --tone-Wert.
+static bool isToneValid(const string& name) {
+    return findTone(name) != nullptr;
+}
+
+// Synthetisiert einen eingebauten Klang im Mixer-Format (22050 Hz, 16-bit, mono).
+static vector<int16_t> synthesizeTone(const ToneDef& def) {
+    constexpr float PI2     = 6.28318530f;
+    constexpr float ATTACK  = 0.004f; // 4 ms Einschwingen gegen Knacken
+    constexpr float RELEASE = 0.010f; // 10 ms Ausblenden am Notenende
+
+    float total = 0.0f;
+    for (int n = 0; n < def.noteCount; ++n)
+        total = max(total, def.notes[n].start + def.notes[n].length + RELEASE);
+    vector<float> acc(static_cast<size_t>(total * MIX_RATE) + 1, 0.0f);
+
+    for (int n = 0; n < def.noteCount; ++n) {
+        const ToneNote& note = def.notes[n];
+        const size_t first = static_cast<size_t>(note.start * MIX_RATE);
+        const size_t count = static_cast<size_t>((note.length + RELEASE) * MIX_RATE);
+        for (int p = 0; p < def.partialCount; ++p) {
+            const TonePartial& part = def.partials[p];
+            const float freq = note.freq * part.ratio;
+            if (freq >= MIX_RATE / 2.0f) continue; // oberhalb Nyquist: weglassen
+            // Sinus per Rotation statt sinf() pro Sample; Abklingen als fester Faktor
+            const float w  = PI2 * freq / MIX_RATE;
+            const float cw = cosf(w), sw = sinf(w);
+            const float fall = expf(-1.0f / (part.decay * MIX_RATE));
+            float re = 1.0f, im = 0.0f, amp = part.amp;
+            for (size_t i = 0; i < count && first + i < acc.size(); ++i) {
+                const float t = static_cast<float>(i) / MIX_RATE;
+                float env = amp;
+                if (t < ATTACK)            env *= t / ATTACK;
+                else if (t > note.length)  env *= max(0.0f, 1.0f - (t - note.length) / RELEASE);
+                acc[first + i] += env * im;
+                const float nre = re * cw - im * sw;
+                im = re * sw + im * cw;
+                re = nre;
+                amp *= fall;
+            }
+        }
+    }
+
+    float peak = 0.0f;
+    for (float v : acc) peak = max(peak, fabsf(v));
+    const float scale = peak > 0.0f ? def.gain * 32767.0f / peak : 0.0f;
+    vector<int16_t> pcm(acc.size());
+    for (size_t i = 0; i < acc.size(); ++i)
+        pcm[i] = static_cast<int16_t>(lrintf(acc[i] * scale));
+    return pcm;
+}
+
+// Eingebauter Klang als Mixer-Stimme (pro Name einmalig synthetisiert und vermessen).
+static PcmPtr builtinTonePcm(const string& name, float* gain = nullptr) {
+    struct Entry { const ToneDef* def; PcmPtr pcm; float gain; };
+    static mutex cacheMtx;
+    static vector<Entry> cache;
+    const ToneDef* def = findTone(name);
+    if (!def) def = &TONES[0];
+    lock_guard<mutex> lk(cacheMtx);
+    auto it = find_if(cache.begin(), cache.end(), [&](const Entry& e){ return e.def == def; });
+    if (it == cache.end()) {
+        auto pcm = make_shared<const vector<int16_t>>(synthesizeTone(*def));
+        cache.push_back({def, pcm, loudnessGain(*pcm)});
+        it = cache.end() - 1;
+    }
+    if (gain) *gain = it->gain;
+    return it->pcm;
+}
+
+// Pegel des Voralarms: ein einzelner Beep wird einmal vermessen.
+static float preAlarmGain() {
+    static const float gain = [] {
+        vector<uint8_t> wav = buildPreAlarmWav(1, 0);
+        PcmPtr pcm = pcmFromWav(wav.data(), wav.size());
+        return pcm ? loudnessGain(*pcm, PREALARM_OFFSET_DB) : 1.0f;
+    }();
+    return gain;
+}
+
+// ── Metronom (--metronome / --beep-every) ─────────────────────────────
+// Eine Klickspur als Generator-Stimme: Klick k beginnt exakt bei Sample
+// round(k * Periode), gezählt ab dem ersten gemischten Block. Die Abstände
+// hängen damit nur am Audiotakt, nicht am Scheduler; auch über Stunden
+// sammelt sich kein Rundungsfehler an. Das Muster legt je Schlag fest:
+//   X = betonter Klick, x = normaler Klick, . = Pause
+constexpr double METRONOME_MIN_PERIOD_MS = 50.0; // kürzer als ein Klick + Luft: nicht sinnvoll
+
+static bool isAccentPatternValid(const string& pattern) {
+    return !pattern.empty() && pattern.find_first_not_of("Xx.") == string::npos;
+}
+
+// Kurzer Klick (30 ms); betont: höher und lauter.
+static PcmPtr clickPcm(bool accent) {
+    static const TonePartial PARTIALS[] = { { 1.00f, 1.00f, 0.012f }, { 2.40f, 0.40f, 0.006f } };
+    static const ToneNote    ACCENT[]   = { { 0.0f, 1760.0f, 0.03f } };
+    static const ToneNote    NORMAL[]   = { { 0.0f, 1320.0f, 0.03f } };
+    static const PcmPtr accentPcm = make_shared<const vector<int16_t>>(
+        synthesizeTone({ "click-accent", PARTIALS, 2, ACCENT, 1, 0.80f }));
+    static const PcmPtr normalPcm = make_shared<const vector<int16_t>>(
+        synthesizeTone({ "click", PARTIALS, 2, NORMAL, 1, 0.50f }));
+    return accent ? accentPcm : normalPcm;
+}
+
+class ClickTrack : public VoiceGenerator {
+public:
+    ClickTrack(double periodSamples, string pattern)
+        : period(periodSamples), pattern(std::move(pattern)),
+          accentPcm(clickPcm(true)), normalPcm(clickPcm(false)) {}
+
+    bool render(float* acc, int n, float gain) override {
+        const long long blockEnd = pos + n;
+        // Rest eines im vorigen Block begonnenen Klicks
+        if (cur) mixClick(acc, 0, n, gain);
+        // Alle Klicks, die in diesem Block beginnen
+        for (;;) {
+            const long long start = llround(static_cast<double>(beat) * period);
+            if (start >= blockEnd) break;
+            const char c = pattern[static_cast<size_t>(beat % static_cast<long long>(pattern.size()))];
+            ++beat;
+            if (c == '.') continue;
+            cur    = (c == 'X') ? accentPcm.get() : normalPcm.get();
+            curPos = 0;
+            mixClick(acc, static_cast<int>(start - pos), n, gain);
+        }
+        pos = blockEnd;
+        return true; // endlos; beendet wird über AudioMixer::stop()
+    }
+
+private:
+    void mixClick(float* acc, int offset, int n, float gain) {
+        int m = static_cast<int>(min<size_t>(n - offset, cur->size() - curPos));
+        mixAccumulate(acc + offset, cur->data() + curPos, m, gain);
+        curPos += m;
+        if (curPos >= cur->size()) cur = nullptr;
+    }
+
+    const double  period;
+    const string  pattern;
+    const PcmPtr  accentPcm, normalPcm;
+    long long     pos    = 0;   // Sample-Index des aktuellen Blockanfangs
+    long long     beat   = 0;   // nächster Schlag
+    const vector<int16_t>* cur = nullptr; // laufender Klick
+    size_t        curPos = 0;
+};
+
+// Verpackt PCM im Mixer-Format als WAV-Datei im Speicher (für PlaySound als Rückfallebene).
+static vector<uint8_t> wavFromPcm(const vector<int16_t>& pcm) {
+    vector<uint8_t> w(44 + pcm.size() * 2);
+    writeWavHeader(w.data(), static_cast<uint32_t>(pcm.size() * 2));
+    memcpy(w.data() + 44, pcm.data(), pcm.size() * 2);
+    return w;
+}
+
+// Prüft einen --audio-backend-Wert: "winmm", "null" oder "wav:<Datei>".
+static bool isAudioBackendValid(const string& spec) {
+    return spec == "winmm" || spec == "null" || (spec.rfind("wav:", 0) == 0 && spec.size() > 4);
+}
+
+// Setzt den Sink des Mixers gemäß --audio-backend (vor der ersten Wiedergabe).
+static void configureAudioBackend(const string& spec) {
+    auto& mixer = AudioMixer::instance();
+    if (spec == "null")
+        mixer.setSink(make_unique<NullSink>(), AudioBackend::Null);
+    else if (spec.rfind("wav:", 0) == 0)
+        mixer.setSink(make_unique<WavFileSink>(toWideArgv(spec.substr(4))), AudioBackend::WavFile);
+    // "winmm" oder leer: Standard-Sink, wird von startWorker() angelegt
+    mixer.startWorker();
+}
+
+// Erkennt, ob Teefax aus einer bestehenden Konsole aufgerufen wurde
+// oder ob Windows selbst die Konsole erstellt hat (= Doppelklick)
+bool launchedFromExistingConsole() {
+    HWND hwnd = GetConsoleWindow();
+    if (!hwnd) return false;
+
+    DWORD consoleProc = 0;
+    GetWindowThreadProcessId(hwnd, &consoleProc);
+
+    // Wenn die Konsole einem anderen Prozess gehört, wurde sie geerbt
+    return (consoleProc != GetCurrentProcessId());
+}
+
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Konfigurationsstruktur ─────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Höchste Bildrate der Stoppuhr: die Anzeige löst Hundertstelsekunden auf
+constexpr int STOPWATCH_MAX_FPS = 100;
+
+// Kleinster Abstand der Tick-Ereignisse bei --output jsonl
+constexpr long long OUTPUT_TICK_MIN_MS = 10;
+
+// Fasst alle geparsten Einstellungen zusammen.
+// Felder mit Laufzeit-Zustand (loopCount, atYear) werden zur Laufzeit verändert.
+struct TimerConfig {
+    // Ton
+    string    soundFile;
+    bool      mute          = false;
+    bool      asyncSound    = false;
+    long long alarmRepeat   = 1;
+    int       alarmInterval = 2;
+    string    audioBackend  = "winmm";
+    string    tone          = "chime";
+    // --metronome / --beep-every: Klickabstand in Samples (0 = aus), --accent: Muster
+    double    clickPeriodSamples = 0.0;
+    string    accentPattern = "x";
+    // Audio-Timing; --calibrate-audio misst beides und schreibt es in die teefax.ini
+    int       audioOpenMs    = 500; // Geraet öffnen bis zum ersten hörbaren Sample
+    int       audioLatencyMs = 0;   // Ausgabelatenz im eingeschwungenen Zustand
+    bool      calibrateAudio = false;
+
+    // Zeitangabe
+    long long ms            = 0;
+    bool      useAtTime     = false;
+    bool      useAtDateTime = false;
+    long long atYear = 0; // long long: sonst verfaelscht sscanf Jahreszahlen jenseits ~2,147 Mrd. lautlos
+    int       atMonth = 0, atDay = 0;
+    int       atHour = 0, atMinute = 0, atSecond = 0;
+
+    // Schleife
+    bool      loop     = false;
+    int       maxLoops = -1;
+
+    // Voralarm
+    int       preAlarmSeconds = 0;
+
+    // Benachrichtigung
+    bool      showMessage = true;
+    string    customMsg;
+
+    // Aktionen nach Ablauf
+    string    openFile;
+    string    cmdArg;
+    string    focusWindow;
+
+    // Modi
+    bool      showLiveTime  = false;
+    bool      showStopwatch = false;
+    int       stopwatchFps  = 100; // --fps: Bilder pro Sekunde der Stoppuhr
+    string    lapsFile;            // --laps: Rundenexport der Stoppuhr (.json, sonst CSV)
+    bool      noSleep       = false;
+    bool      eco           = false;
+    bool      watchConfig   = false; // --watch-config: teefax.ini zwischen Durchläufen neu laden
+
+    // --bar smooth: Balken in Achtelzellen statt '#'/'-'
+    bool      smoothBar    = false;
+
+    // --output jsonl: Ereignisstrom statt Anzeige; --output-tick: Abstand der Tick-Ereignisse
+    bool      jsonOutput   = false;
+    long long outputTickMs = 1000;
+
+    // Täglicher / wiederkehrender Alarm
+    vector<tuple<int,int,int>> dailyTimes;
+    bool      useDailyTimes = false;
+    EverySpec everySpec;
+    bool      useEvery      = false;
+
+    // --for: Gesamtlaufzeit der Schleife begrenzen
+    long long forMs  = 0;     // 0 = deaktiviert
+    bool      useFor = false;
+
+    // Schleifenzustand – wird zur Laufzeit verändert
+    long long loopCount = 0;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Konsolenmodus-Helfer ───────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Deaktiviert QuickEdit im aktuellen Konsolenfenster.
+// Verhindert, dass ein Mausklick den Timer einfriert.
+static void disableQuickEdit() {
+    HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD  mode = 0;
+    if (GetConsoleMode(hIn, &mode)) {
+        mode &= ~ENABLE_QUICK_EDIT_MODE;
+        mode |=  ENABLE_EXTENDED_FLAGS;
+        SetConsoleMode(hIn, mode);
+        g_consoleModeChanged = true;
+    }
+}
+
+// Stellt den gespeicherten Originalzustand des Konsolenmodus wieder her.
+static void restoreConsoleMode() {
+    if (g_consoleModeChanged) {
+        SetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), g_originalConsoleMode);
+        g_consoleModeChanged = false;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Zeilen-Renderer ────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Zeichnet die Statuszeile (Balken, Stoppuhr, Uhr) als Frame. Der vorige Frame
+// bleibt gespeichert; mit VT-Sequenzen werden nur die geänderten Zellen per
+// Cursor-Positionierung (CSI n G) neu geschrieben. Jeder Frame geht in genau
+// einem Schreibaufruf an die Konsole – Konsolen-I/O ist der teuerste Aufruf in
+// der Tick-Schleife und über Remote-Sitzungen besonders langsam.
+// Zeilen kommen als UTF-8 und werden als UTF-16-Zellen verglichen und mit
+// WriteConsoleW ausgegeben: Blockzeichen des feinen Balkens (--bar smooth)
+// erscheinen so unabhängig von der Konsolen-Codepage, und Spalten stimmen auch
+// bei Mehrbyte-Zeichen.
+// Ohne VT (ältere Konsolen) oder bei umgeleiteter Ausgabe: ganze Zeile mit "\r",
+// Reste des vorigen Frames werden mit Leerzeichen überschrieben.
+class LineRenderer {
+public:
+    static constexpr int MAX_LINE = 512;
+
+    // Nach fremder Ausgabe (Zeilenumbruch, Meldungen) aufrufen: der nächste
+    // Frame wird vollständig gezeichnet.
+    void reset() { prevLen = -1; }
+
+    void draw(const char* line, int len) {
+        if (!initialized) init();
+        if (len > MAX_LINE) len = MAX_LINE;
+        wchar_t cells[MAX_LINE];
+        int cellCount = len > 0 ? MultiByteToWideChar(CP_UTF8, 0, line, len, cells, MAX_LINE) : 0;
+        if (!isConsole) {
+            // Umgeleitet: UTF-8 unverändert weitergeben
+            cout.put('\r').write(line, len);
+            for (int i = cellCount; i < prevLen; ++i) cout.put(' ');
+            cout.flush();
+        } else {
+            int n = (vt && prevLen >= 0) ? buildDiff(cells, cellCount) : buildFull(cells, cellCount);
+            if (n > 0) {
+                cout.flush(); // gepufferte cout-Ausgabe muss vor dem Frame stehen
+                DWORD written = 0;
+                WriteConsoleW(hOut, out, static_cast<DWORD>(n), &written, nullptr);
+            }
+        }
+        wmemcpy(prev, cells, static_cast<size_t>(cellCount));
+        prevLen = cellCount;
+    }
+
+private:
+    void init() {
+        initialized = true;
+        hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+        DWORD mode = 0;
+        isConsole = hOut != INVALID_HANDLE_VALUE && GetConsoleMode(hOut, &mode);
+        vt = isConsole && ((mode & ENABLE_VIRTUAL_TERMINAL_PROCESSING) ||
+                           SetConsoleMode(hOut, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING));
+    }
+
+    // Vollständige Zeile: "\r" + Text + Rest des vorigen Frames löschen.
+    int buildFull(const wchar_t* line, int len) {
+        int n = 0;
+        out[n++] = L'\r';
+        wmemcpy(out + n, line, static_cast<size_t>(len)); n += len;
+        if (vt) {
+            wmemcpy(out + n, L"\x1b[K", 3); n += 3;
+        } else {
+            for (int i = len; i < prevLen; ++i) out[n++] = L' ';
+        }
+        return n;
+    }
+
+    // CSI <col> G: Cursor in Spalte col (1-basiert).
+    int appendColumn(int n, int col) {
+        wchar_t digits[8];
+        int d = 0;
+        do { digits[d++] = static_cast<wchar_t>(L'0' + col % 10); col /= 10; } while (col > 0);
+        out[n++] = L'\x1b';
+        out[n++] = L'[';
+        while (d > 0) out[n++] = digits[--d];
+        out[n++] = L'G';
+        return n;
+    }
+
+    // Nur geänderte Zellen. Kurze unveränderte Lücken werden mitgeschrieben,
+    // weil eine neue Positionierung mehr Zeichen kostet als die Zellen selbst.
+    int buildDiff(const wchar_t* line, int len) {
+        constexpr int MIN_GAP = 6;
+        int n = 0;
+        int i = 0;
+        while (i < len) {
+            if (i < prevLen && line[i] == prev[i]) { ++i; continue; }
+            int runEnd = i + 1, same = 0;
+            for (int j = i + 1; j < len && same < MIN_GAP; ++j) {
+                if (j < prevLen && line[j] == prev[j]) ++same;
+                else { same = 0; runEnd = j + 1; }
+            }
+            n = appendColumn(n, i + 1);
+            wmemcpy(out + n, line + i, static_cast<size_t>(runEnd - i));
+            n += runEnd - i;
+            i = runEnd;
+        }
+        if (len < prevLen) {
+            n = appendColumn(n, len + 1);
+            wmemcpy(out + n, L"\x1b[K", 3); n += 3;
+        }
+        return n;
+    }
+
+    HANDLE  hOut        = nullptr;
+    bool    initialized = false;
+    bool    isConsole   = false;
+    bool    vt          = false;
+    int     prevLen     = -1;      // Zellen des vorigen Frames
+    wchar_t prev[MAX_LINE];
+    wchar_t out[MAX_LINE * 6 + 64]; // schlimmster Fall: jede Zelle mit eigener Positionierung
+};
+
+static LineRenderer g_statusLine;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Konsoleneingabe und -größe ─────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Ein Hintergrund-Thread liest die Konsoleneingabe ereignisgesteuert: Größen-
+// änderungen (WINDOW_BUFFER_SIZE_EVENT) aktualisieren die zwischengespeicherte
+// Breite, Tastendrücke landen in einer kleinen Warteschlange. Die Tick-Schleifen
+// fragen damit weder GetConsoleScreenBufferInfo noch _kbhit() pro Frame ab.
+// Während --cmd-Kindprozesse laufen, pausiert der Leser (suspend/resume), damit
+// er ihnen keine Eingaben wegnimmt.
+class ConsoleInput {
+public:
+    static ConsoleInput& instance() { static ConsoleInput c; return c; }
+
+    // Startet den Leser, falls die Eingabe eine Konsole ist (einmalig).
+    void start() {
+        if (wakeEvent) return;
+        hIn = GetStdHandle(STD_INPUT_HANDLE);
+        DWORD mode = 0;
+        if (hIn == INVALID_HANDLE_VALUE || !GetConsoleMode(hIn, &mode)) return;
+        enableWindowInput();
+        refreshWidth();
+        keyEvent  = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        wakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        reader = thread([this]{ threadMain(); });
+        reader.detach(); // blockiert bis Programmende in WaitForMultipleObjects
+    }
+
+    void suspend() {
+        if (!wakeEvent) return;
+        suspended.store(true);
+        SetEvent(wakeEvent);
+    }
+
+    void resume() {
+        if (!wakeEvent) return;
+        enableWindowInput(); // restoreConsoleMode() hat den Modus zurückgesetzt
+        refreshWidth();      // Größenänderungen während der Pause nachholen
+        suspended.store(false);
+        SetEvent(wakeEvent);
+    }
+
+    // Sichtbare Spalten des Konsolenfensters; 0 = unbekannt (keine Konsole).
+    int width() {
+        if (!wakeEvent) refreshWidth(); // ohne Leser: direkt abfragen
+        return consoleWidth.load(memory_order_relaxed);
+    }
+
+    // Erhöht sich bei jeder Größenänderung (Layout nur dann neu berechnen).
+    unsigned generation() const { return widthGeneration.load(memory_order_relaxed); }
+
+    // Nächster Tastendruck (UTF-16-Wert, nur ASCII) aus der Warteschlange.
+    bool pollKey(int& key) {
+        if (!wakeEvent) { // Eingabe umgeleitet: wie bisher über die CRT
+            if (!_kbhit()) return false;
+            key    = _getwch();
+            if (key >= 0x80) key = 0; // keine Tastenbelegung außerhalb von ASCII
+            lastAt = chrono::steady_clock::now();
+            return true;
+        }
+        // Einzelner Leser (Zeitschleife) gegen einzelnen Schreiber (Leser-Thread):
+        // ohne Sperre, die Freigabe von keyHead gibt den Platz erst nach dem Lesen frei.
+        unsigned head = keyHead.load(memory_order_relaxed);
+        if (head == keyTail.load(memory_order_acquire)) return false;
+        key    = keys[head % KEY_CAPACITY];
+        lastAt = keyTimes[head % KEY_CAPACITY];
+        keyHead.store(head + 1, memory_order_release);
+        return true;
+    }
+
+    // Zeitpunkt, zu dem der zuletzt gelesene Tastendruck eintraf (Leser-Thread);
+    // für Zwischenzeiten genauer als der Moment des Abholens.
+    chrono::steady_clock::time_point keyTime() const { return lastAt; }
+
+    // true, wenn ein Konsolenleser läuft und waitKey() ohne Abfrageschleife wartet.
+    bool available() const { return wakeEvent != nullptr; }
+
+    // Wie pollKey(), wartet aber bis zu timeoutMs auf einen Tastendruck (INFINITE
+    // möglich), ohne zwischendurch aufzuwachen. Ein gesetztes 'also' bzw. 'also2'
+    // beendet das Warten vorzeitig (Rückgabe false), etwa das Ende einer Mixer-Stimme
+    // oder ein Steuerbefehl.
+    bool waitKey(int& key, DWORD timeoutMs, HANDLE also = nullptr, HANDLE also2 = nullptr) {
+        if (pollKey(key)) return true;
+        if (!also) swap(also, also2);
+        if (!wakeEvent) { // CRT-Rückfall kennt kein Warteobjekt: grob abfragen
+            auto until = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+            for (;;) {
+                if (also && WaitForSingleObject(also, 0) == WAIT_OBJECT_0) return false;
+                if (also2 && WaitForSingleObject(also2, 0) == WAIT_OBJECT_0) return false;
+                auto slice = chrono::milliseconds(50);
+                if (timeoutMs != INFINITE) {
+                    auto left = chrono::duration_cast<chrono::milliseconds>(until - chrono::steady_clock::now());
+                    if (left <= chrono::milliseconds(0)) return false;
+                    slice = min(slice, left);
+                }
+                this_thread::sleep_for(slice);
+                if (pollKey(key)) return true;
+            }
+        }
+        HANDLE handles[3] = { keyEvent, also, also2 };
+        const DWORD count = also2 ? 3 : also ? 2 : 1;
+        if (WaitForMultipleObjects(count, handles, FALSE, timeoutMs) != WAIT_OBJECT_0)
+            return false;
+        return pollKey(key);
+    }
+
+private:
+    static constexpr unsigned KEY_CAPACITY = 32;
+
+    ConsoleInput() = default;
+
+    void enableWindowInput() {
+        DWORD mode = 0;
+        if (GetConsoleMode(hIn, &mode) && !(mode & ENABLE_WINDOW_INPUT))
+            SetConsoleMode(hIn, mode | ENABLE_WINDOW_INPUT);
+    }
+
+    void refreshWidth() {
+        CONSOLE_SCREEN_BUFFER_INFO csbi;
+        int w = GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)
+                    ? csbi.srWindow.Right - csbi.srWindow.Left + 1 : 0;
+        if (consoleWidth.exchange(w, memory_order_relaxed) != w)
+            widthGeneration.fetch_add(1, memory_order_relaxed);
+    }
+
+    void pushKey(int key) {
+        unsigned tail = keyTail.load(memory_order_relaxed);
+        if (tail - keyHead.load(memory_order_acquire) < KEY_CAPACITY) {
+            keys[tail % KEY_CAPACITY]     = key;
+            keyTimes[tail % KEY_CAPACITY] = chrono::steady_clock::now();
+            keyTail.store(tail + 1, memory_order_release); // Taste erst nach dem Schreiben sichtbar
+        }
+        SetEvent(keyEvent);
+    }
+
+    void threadMain() {
+        INPUT_RECORD recs[16];
+        for (;;) {
+            if (suspended.load()) {
+                WaitForSingleObject(wakeEvent, INFINITE);
+                continue;
+            }
+            HANDLE handles[2] = { hIn, wakeEvent };
+            if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0)
+                continue; // geweckt: Pause-Zustand neu prüfen
+            if (suspended.load()) continue;
+            DWORD n = 0;
+            if (!ReadConsoleInputW(hIn, recs, 16, &n)) {
+                this_thread::sleep_for(chrono::milliseconds(50));
+                continue;
+            }
+            for (DWORD i = 0; i < n; ++i) {
+                if (recs[i].EventType == WINDOW_BUFFER_SIZE_EVENT) {
+                    refreshWidth(); // Fensterbreite, nicht Puffergröße aus dem Ereignis
+                } else if (recs[i].EventType == KEY_EVENT && recs[i].Event.KeyEvent.bKeyDown) {
+                    // UTF-16-Zeichen, nicht AsciiChar: dessen unteres Byte machte aus
+                    // kyrillischen Tasten (z. B. U+0451) Steuertasten wie 'Q'.
+                    // Alle Tastenbefehle sind ASCII, alles darüber wird verworfen.
+                    wchar_t c = recs[i].Event.KeyEvent.uChar.UnicodeChar;
+                    if (c && c < 0x80) pushKey(c);
+                }
+            }
+        }
+    }
+
+    HANDLE        hIn       = nullptr;
+    HANDLE        wakeEvent = nullptr;
+    HANDLE        keyEvent  = nullptr; // gesetzt bei jedem neuen Tastendruck
+    thread        reader;
+    atomic<bool>  suspended{false};
+    atomic<int>   consoleWidth{0};
+    atomic<unsigned> widthGeneration{0};
+    int           keys[KEY_CAPACITY]{};
+    chrono::steady_clock::time_point keyTimes[KEY_CAPACITY]{};
+    chrono::steady_clock::time_point lastAt{}; // nur Zeitschleife, siehe keyTime()
+    atomic<unsigned> keyHead{0}, keyTail{0}; // SPSC-Ring, Überlauf verwirft Tasten
+};
+
+// Anzeigebreite eines UTF-8-Texts in Spalten (LineRenderer-Eingabe): Folgebytes
+// zählen nicht mit.
+static int displayWidth(const char* text, size_t len) {
+    int cols = 0;
+    for (size_t i = 0; i < len; ++i)
+        if ((static_cast<unsigned char>(text[i]) & 0xC0) != 0x80) ++cols;
+    return cols;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Argument-Vorverarbeitung ───────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Setzt TEEFAX_LANG anhand des letzten --lang-Vorkommens in der Argumentliste.
+// Wird zweimal aufgerufen: vor dem --macro-Handler (damit dessen Meldungen
+// bereits in der gewählten Sprache erscheinen) und nach der Makro-Expansion
+// (damit CLI-Argumente einen INI-Wert überschreiben können).
+static void detectLanguageFromArgs(const vector<string>& args) {
+    for (int i = 0; i + 1 < static_cast<int>(args.size()); ++i) {
+        if (args[i] == "--lang" || args[i] == "-la")
+            _putenv_s("TEEFAX_LANG", args[i + 1].c_str());
+    }
+}
+
+// Wertet --macro-Unterbefehle aus und kehrt sofort zurück.
+// Rückgabe: 0 oder 1 (Exitcode) wenn --macro gefunden wurde; -1 wenn nicht.
+static int handleMacroCommands(vector<string>& args) {
+    const int n = static_cast<int>(args.size());
+    for (int i = 0; i < n; ++i) {
+        if (args[i] != "--macro") continue;
+
+        if (i + 1 >= n) {
+            cout << t(Str::MACRO_MISSING_SUBCMD) << "\n";
+            return 1;
+        }
+
+        string subcmd = args[i + 1];
+        char   buf[256];
+
+        if (!isMacroSubCmdValid(subcmd)) {
+            snprintf(buf, sizeof(buf), t(Str::MACRO_INVALID_SUBCMD), subcmd.c_str());
+            cout << buf << "\n";
+            return 1;
+        }
+
+        // ── list ──────────────────────────────────────────────────────
+        if (subcmd == "list") {
+            IniConfig& ini = IniConfig::instance();
+            if (ini.macros().empty()) {
+                cout << t(Str::MACRO_LIST_EMPTY) << "\n";
+            } else {
+                cout << t(Str::MACRO_LIST_HEADER) << "\n";
+                for (size_t m = 0; m < ini.macros().size(); ++m) {
+                    if (!ini.isCurrent(m)) continue;
+                    const IniConfig::Macro& mac = ini.macros()[m];
+                    cout << "  " << mac.name;
+                    if (!mac.params.empty()) cout << "(" << mac.params << ")";
+                    cout << " = " << mac.value << "\n";
+                }
+            }
+            return 0;
+        }
+
+        // ── remove ────────────────────────────────────────────────────
+        if (subcmd == "remove") {
+            if (i + 2 >= n) { cout << t(Str::MACRO_MISSING_NAME) << "\n"; return 1; }
+            string name = args[i + 2];
+            if (removeMacroFromIni(name)) {
+                snprintf(buf, sizeof(buf), t(Str::MACRO_REMOVED), name.c_str());
+                cout << buf << "\n";
+                return 0;
+            } else {
+                snprintf(buf, sizeof(buf), t(Str::MACRO_NOT_FOUND), name.c_str());
+                cout << buf << "\n";
+                return 1;
+            }
+        }
+
+        // ── add ───────────────────────────────────────────────────────
+        if (subcmd == "add") {
+            if (i + 2 >= n) { cout << t(Str::MACRO_MISSING_NAME) << "\n"; return 1; }
+            // "name" oder "name(a,b)": Name und Parameter nur aus Buchstaben und Ziffern
+            string      signature = args[i + 2];
+            string_view nameView, paramList;
+            bool        valid = splitMacroSignature(signature, nameView, paramList);
+            string      name(nameView);
+            valid = valid && isMacroNameValid(name);
+            for (const auto& param : splitMacroParams(paramList))
+                valid = valid && isMacroNameValid(param);
+            if (!valid) {
+                snprintf(buf, sizeof(buf), t(Str::MACRO_INVALID_NAME), signature.c_str());
+                cout << buf << "\n"; return 1;
+            }
+            if (isMacroNameReserved(name)) {
+                snprintf(buf, sizeof(buf), t(Str::MACRO_NAME_RESERVED), name.c_str());
+                cout << buf << "\n"; return 1;
+            }
+            if (i + 3 >= n) { cout << t(Str::MACRO_MISSING_ARGS) << "\n"; return 1; }
+
+            // Alle verbleibenden Token als Makro-Body zusammenfügen.
+            // Quoting-Regeln: Token mit Leerzeichen -> quoten (schuetzt mehrwortige Werte
+            // beim spaeteren Wiedereinlesen durch tokenizeConfigLine). Zusaetzlich wird der
+            // Wert eines Freitext-Schalters vorsorglich quotiert, selbst ohne Leerzeichen,
+            // damit ein Wert, der zufaellig mit '-' beginnt, beim Wiedereinlesen nicht als
+            // eigener Schalter fehlgedeutet wird.
+            //
+            // Absichtlich NUR die Freitext-Schalter mit genau einem Wert, der grundsaetzlich
+            // beliebigen Text enthalten kann (Fenstertitel, Dateipfad, Konsolenbefehl):
+            // --focus, --sound, --open, --cmd sowie --audio-backend (wav:<Datei>) und --laps
+            // (Exportdatei). Alle uebrigen Wert-Schalter (--at, --daily, --every, --alarm-repeat,
+            // --alarm-interval, --prealarm, --lang, --loop, --tone, --fps ...) nehmen
+            // ausschliesslich strukturierte Werte entgegen - Zahlen, Uhrzeiten, Datumsangaben,
+            // Sprachcodes -, die niemals ein Leerzeichen enthalten und daher nie eine
+            // Quotierung benoetigen. Wuerden sie dennoch in diese Liste aufgenommen, entstuende
+            // derselbe Fehler wie zuvor bei --loop: Schalter mit MEHREREN nachfolgenden Werten
+            // (--daily nimmt beliebig viele Uhrzeiten, --every und --at je bis zu zwei) erhielten
+            // nur beim ERSTEN Wert faelschlich Anfuehrungszeichen, waehrend die uebrigen
+            // unquotiert blieben - ein irrefuehrendes, asymmetrisches Bild in der teefax.ini.
+            static const vector<string> valueFlags = {
+                "--focus", "-f", "--sound", "-s", "--open", "-o", "--cmd", "-c",
+                "--audio-backend", "--laps",
+            };
+            string macroArgs;
+            bool nextNeedsQuotes = false;
+            for (int j = i + 3; j < n; ++j) {
+                if (j > i + 3) macroArgs += " ";
+                const string& tok = args[j];
+                bool needsQuotes = nextNeedsQuotes || tok.find(' ') != string::npos;
+                nextNeedsQuotes = false;
+                for (const auto& vf : valueFlags)
+                    if (tok == vf) { nextNeedsQuotes = true; break; }
+                if (needsQuotes) macroArgs += '"';
+                macroArgs += tok;
+                if (needsQuotes) macroArgs += '"';
+            }
+
+            // Rückfrage wenn Makro bereits existiert
+            if (IniConfig::instance().findMacro(name)) {
+                snprintf(buf, sizeof(buf), t(Str::MACRO_OVERWRITE_PROMPT), name.c_str());
+                cout << buf << flush;
+                if (g_consoleModeChanged)
+                    SetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), g_originalConsoleMode);
+                string answer;
+                getline(cin, answer);
+                if (g_consoleModeChanged) {
+                    HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
+                    DWORD  mode = 0;
+                    if (GetConsoleMode(hIn, &mode)) {
+                        mode &= ~ENABLE_QUICK_EDIT_MODE;
+                        mode |=  ENABLE_EXTENDED_FLAGS;
+                        SetConsoleMode(hIn, mode);
+                    }
+                }
+                string yesChars = t(Str::MACRO_OVERWRITE_YES);
+                if (answer.empty() || yesChars.find(answer[0]) == string::npos)
+                    return 0;
+            }
+            if (!saveMacroToIni(signature, macroArgs)) {
+                cout << t(Str::MACRO_SAVE_FAILED) << "\n";
+                return 1;
+            }
+            snprintf(buf, sizeof(buf), t(Str::MACRO_ADDED), name.c_str());
+            cout << buf << "\n";
+            return 0;
+        }
+    }
+    return -1; // kein --macro gefunden
+}
+
+// Flags, deren naechstes Token ein freier Wert ist (kein Makroname)
+static bool isMacroValueFlag(const string& a) {
+    static const vector<string> valueFlags = {
+        "--sound",         "-s",       "--cmd",    "-c",       "--open",   "-o",
+        "--focus",         "-f",       "--at",     "-a",   "--until",
+        "--lang",          "-la",      "--for",    "--audio-backend", "--tone",
+        "--metronome",     "--beep-every", "--accent",
+        "--output",        "--output-tick", "--bar", "--fps", "--laps",
+        "--audio-open-ms", "--audio-latency-ms",
+        "--alarm-repeat",  "-ar",      "--alarm-interval", "-ai",
+        "--prealarm",      "-pa",      "--loop",   "-l",
+        "--every",         "-e",       "--daily",  "-d"
+    };
+    for (const auto& vf : valueFlags)
+        if (a == vf) return true;
+    return false;
+}
+
+// Verschachtelte Makros mit Parametern:
+//   macro brew(t) = $t --prealarm 5 "Tee"
+//   macro gruen   = brew 2m --sound gong.wav
+// Die Argumente folgen dem Makronamen als eigene Tokens ("teefax brew 3m").
+// $name bzw. ${name} im Rumpf wird durch das Argument ersetzt, danach werden
+// Makroaufrufe im Rumpf rekursiv expandiert. Ergebnisse werden je Aufruf
+// (Name + Argumente) gemerkt, sodass gemeinsam genutzte Teilmakros nur einmal
+// expandiert werden; ein Makro, das sich selbst (auch indirekt) aufruft, ist
+// ein Fehler.
+class MacroExpander {
+public:
+    // Anzahl der Parameter eines Makros; -1, wenn 'name' kein Makro ist.
+    int arity(const string& name) {
+        const Def* d = def(name);
+        return d ? static_cast<int>(d->params.size()) : -1;
+    }
+
+    // Aufruf 'name' mit den Argumenten args[0..arity) expandieren und an 'out'
+    // anhängen. false nach ausgegebener Fehlermeldung.
+    bool expand(const string& name, const string* args, vector<string>& out) {
+        const Def* d   = def(name);
+        string     key = name;
+        for (size_t i = 0; i < d->params.size(); ++i) { key += '\x1f'; key += args[i]; }
+        auto hit = memo.find(key);
+        if (hit != memo.end()) {
+            out.insert(out.end(), hit->second.begin(), hit->second.end());
+            return true;
+        }
+        if (!active.insert(name).second) {
+            char buf[256];
+            snprintf(buf, sizeof(buf), t(Str::MACRO_CYCLE), name.c_str());
+            textOut() << buf << "\n";
+            return false;
+        }
+        vector<string> body;
+        body.reserve(d->body.size());
+        for (const auto& tok : d->body) body.push_back(substitute(tok, d->params, args));
+        vector<string> result;
+        bool ok = expandTokens(body, 0, result);
+        active.erase(name);
+        if (!ok) return false;
+        out.insert(out.end(), result.begin(), result.end());
+        memo.emplace(move(key), move(result));
+        return true;
+    }
+
+    // Tokenfolge ab 'from' durchgehen und jeden Makroaufruf ersetzen.
+    bool expandTokens(const vector<string>& in, size_t from, vector<string>& out) {
+        for (size_t i = from; i < in.size(); ++i) {
+            const string& a = in[i];
+            if (!a.empty() && a[0] == '-') {
+                out.push_back(a);
+                if (isMacroValueFlag(a) && i + 1 < in.size()) out.push_back(in[++i]);
+                continue;
+            }
+            int n = arity(a);
+            if (n < 0) { out.push_back(a); continue; }
+            if (!checkArgs(a, n, in.size() - i - 1)) return false;
+            if (!expand(a, in.data() + i + 1, out)) return false;
+            i += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool checkArgs(const string& name, int n, size_t available) {
+        if (static_cast<size_t>(n) <= available) return true;
+        char buf[256];
+        snprintf(buf, sizeof(buf), t(Str::MACRO_MISSING_PARAMS), name.c_str(), n);
+        textOut() << buf << "\n";
+        return false;
+    }
+
+private:
+    struct Def {
+        vector<string> params, body;
+    };
+
+    // Definition einmal pro Name nachschlagen; nullptr für Nicht-Makros.
+    const Def* def(const string& name) {
+        auto it = defs.find(name);
+        if (it == defs.end()) {
+            Def d;
+            bool found = lookupMacro(name, d.params, d.body);
+            it = defs.emplace(name, found ? make_optional(move(d)) : nullopt).first;
+        }
+        return it->second ? &*it->second : nullptr;
+    }
+
+    // $name / ${name} durch das passende Argument ersetzen; unbekannte Namen bleiben stehen.
+    static string substitute(const string& tok, const vector<string>& params, const string* args) {
+        if (params.empty() || tok.find('$') == string::npos) return tok;
+        string out;
+        for (size_t i = 0; i < tok.size();) {
+            if (tok[i] != '$') { out += tok[i++]; continue; }
+            bool   braced = i + 1 < tok.size() && tok[i + 1] == '{';
+            size_t start  = i + (braced ? 2 : 1);
+            size_t end    = start;
+            while (end < tok.size() && isalnum(static_cast<unsigned char>(tok[end]))) ++end;
+            bool closed = !braced || (end < tok.size() && tok[end] == '}');
+            auto p      = find(params.begin(), params.end(), tok.substr(start, end - start));
+            if (end == start || !closed || p == params.end()) { out += tok[i++]; continue; }
+            out += args[p - params.begin()];
+            i = end + (braced ? 1 : 0);
+        }
+        return out;
+    }
+
+    unordered_map<string, optional<Def>>  defs;
+    unordered_map<string, vector<string>> memo;
+    unordered_set<string>                 active;
+};
+
+// Ersetzt den ersten passenden CLI-Makronamen (samt seiner Argumente) durch die
+// vollständig expandierten Tokens. Nur CLI-Argumente werden geprüft (ab cliStart),
+// damit INI-Tokens nicht versehentlich als Makronamen ausgewertet werden.
+// Rückgabe: false bei Zyklus oder fehlenden Argumenten (Meldung ausgegeben).
+static bool expandMacroInArgs(vector<string>& args, int argc) {
+    int cliStart = static_cast<int>(args.size()) - (argc - 1);
+    if (cliStart < 0) cliStart = 0;
+
+    MacroExpander expander;
+    bool skipNext = false;
+    for (int i = cliStart; i < static_cast<int>(args.size()); ++i) {
+        const string& a = args[i];
+        if (skipNext) { skipNext = false; continue; }
+        if (a[0] == '-') {
+            skipNext = isMacroValueFlag(a);
+            continue;
+        }
+        int n = expander.arity(a);
+        if (n < 0) continue;
+        if (!expander.checkArgs(a, n, args.size() - i - 1)) return false;
+        vector<string> expanded;
+        if (!expander.expand(a, args.data() + i + 1, expanded)) return false;
+        args.erase(args.begin() + i, args.begin() + i + 1 + n);
+        args.insert(args.begin() + i, expanded.begin(), expanded.end());
+        break; // nur einmal expandieren
+    }
+    return true;
+}
+
+// Deaktiviert QuickEdit, sofern ein Timer gestartet wird.
+// Ausgenommen: --help, --version und Aufrufe ohne Argumente.
+static void setupQuickEdit(const vector<string>& args, int argc) {
+    if (argc < 2) return;
+    for (const auto& a : args)
+        if (a == "--help" || a == "-h" || a == "--version" || a == "-v") return;
+
+    HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD  mode = 0;
+    if (GetConsoleMode(hIn, &mode)) {
+        g_originalConsoleMode = mode;
+        g_consoleModeChanged  = true;
+        mode &= ~ENABLE_QUICK_EDIT_MODE;
+        mode |=  ENABLE_EXTENDED_FLAGS;
+        SetConsoleMode(hIn, mode);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Argument-Parser ────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Parst die kombinierte Argumentliste (INI + CLI) in cfg.
+// Rückgabe: -1 = Timer starten; 0 = Exit OK; 1 = Exit Fehler.
+static int parseArguments(const vector<string>& args, TimerConfig& cfg) {
+    const int nArgs = static_cast<int>(args.size());
+    bool timeTokenSeen = false; // true, sobald ein Argument als Zeit akzeptiert wurde
+
+    for (int i = 0; i < nArgs; ++i) {
+        const string& arg = args[i];
+
+        if (arg == "--nosleep" || arg == "-ns") {
+            cfg.noSleep = true;
+
+        } else if (arg == "--eco") {
+            cfg.eco = true;
+
+        } else if (arg == "--watch-config") {
+            cfg.watchConfig = true;
+
+        } else if (arg == "--mute" || arg == "-m") {
+            cfg.mute = true;
+
+        } else if (arg == "--loop" || arg == "-l") {
+            cfg.loop = true;
+            if (i + 1 < nArgs) {
+                int possibleCount = safeStoi(args[i + 1], -1);
+                if (possibleCount > 0) { cfg.maxLoops = possibleCount; ++i; }
+            }
+
+        } else if (arg == "--nomsg") {
+            cfg.showMessage = false;
+
+        } else if ((arg == "--sound" || arg == "-s") && i + 1 < nArgs) {
+            cfg.soundFile = args[++i];
+
+        } else if ((arg == "--alarm-repeat" || arg == "-ar") && i + 1 < nArgs) {
+            const string& val = args[++i];
+            try {
+                size_t pos = 0;
+                cfg.alarmRepeat = stoll(val, &pos, 10);
+                if (pos != val.size() || cfg.alarmRepeat < 0) {
+                    cfg.alarmRepeat = 1;
+                    char w[256]; snprintf(w, sizeof(w), t(Str::WARN_ALARM_REPEAT_INVALID), val.c_str()); fprintf(stderr, "%s\n", w);
+                }
+            } catch (const std::out_of_range&) {
+                cfg.alarmRepeat = std::numeric_limits<long long>::max();
+                char w[256]; snprintf(w, sizeof(w), t(Str::WARN_ALARM_REPEAT_TOO_LARGE), val.c_str(), cfg.alarmRepeat); fprintf(stderr, "%s\n", w);
+            } catch (...) {
+                cfg.alarmRepeat = 1;
+                char w[256]; snprintf(w, sizeof(w), t(Str::WARN_ALARM_REPEAT_INVALID), val.c_str()); fprintf(stderr, "%s\n", w);
+            }
+
+        } else if ((arg == "--alarm-interval" || arg == "-ai") && i + 1 < nArgs) {
+            cfg.alarmInterval = safeStoi(args[++i], 2);
+            if (cfg.alarmInterval < 1) cfg.alarmInterval = 1;
+
+        } else if (arg == "--async" || arg == "-as") {
+            cfg.asyncSound = true;
+
+        } else if (arg == "--audio-open-ms" && i + 1 < nArgs) {
+            cfg.audioOpenMs = max(0, min(10000, safeStoi(args[++i], 500)));
+
+        } else if (arg == "--audio-latency-ms" && i + 1 < nArgs) {
+            cfg.audioLatencyMs = max(0, min(10000, safeStoi(args[++i], 0)));
+
+        } else if (arg == "--calibrate-audio") {
+            cfg.calibrateAudio = true;
+
+        } else if (arg == "--audio-backend" && i + 1 < nArgs) {
+            cfg.audioBackend = args[++i];
+            if (!isAudioBackendValid(cfg.audioBackend)) {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_AUDIO_BACKEND), cfg.audioBackend.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+
+        } else if (arg == "--tone" && i + 1 < nArgs) {
+            cfg.tone = args[++i];
+            if (!isToneValid(cfg.tone)) {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_TONE), cfg.tone.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+
+        } else if ((arg == "--metronome" || arg == "--beep-every") && i + 1 < nArgs) {
+            const string& val = args[++i];
+            // --metronome: Schläge pro Minute; --beep-every: Dauer wie bei der Zeitangabe
+            double periodMs = (arg == "--metronome")
+                                  ? 60000.0 / safeStod(val, 0.0)
+                                  : static_cast<double>(parseTime(val));
+            if (!(periodMs >= METRONOME_MIN_PERIOD_MS) || !isfinite(periodMs)) {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_METRONOME), val.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+            cfg.clickPeriodSamples = periodMs * MIX_RATE / 1000.0;
+
+        } else if (arg == "--accent" && i + 1 < nArgs) {
+            cfg.accentPattern = args[++i];
+            if (!isAccentPatternValid(cfg.accentPattern)) {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_ACCENT), cfg.accentPattern.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+
+        } else if (arg == "--bar" && i + 1 < nArgs) {
+            const string& val = args[++i];
+            if (val != "classic" && val != "smooth") {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_BAR), val.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+            cfg.smoothBar = (val == "smooth");
+
+        } else if (arg == "--output" && i + 1 < nArgs) {
+            const string& val = args[++i];
+            if (val != "text" && val != "jsonl") {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_OUTPUT), val.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+            cfg.jsonOutput = (val == "jsonl");
+
+        } else if (arg == "--output-tick" && i + 1 < nArgs) {
+            const string& val = args[++i];
+            cfg.outputTickMs = parseTime(val);
+            if (cfg.outputTickMs < OUTPUT_TICK_MIN_MS) {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_OUTPUT_TICK), val.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+
+        } else if ((arg == "--at" || arg == "-a" || arg == "--until") && i + 1 < nArgs) {
+            string first = args[++i];
+            long long year; // long long: %d/int wuerde Jahreszahlen jenseits ~2,147 Mrd. lautlos verfaelschen
+            int month, day;
+            int hour = 0, minute = 0, second = 0;
+
+            if (sscanf(first.c_str(), "%lld-%d-%d", &year, &month, &day) == 3) {
+                // Fall 1: Datum erkannt – optionale Uhrzeit prüfen
+                if (i + 1 < nArgs && args[i + 1][0] != '-') {
+                    int parsed = sscanf(args[i + 1].c_str(), "%d:%d:%d", &hour, &minute, &second);
+                    if (parsed >= 2) { if (parsed == 2) second = 0; ++i; }
+                    else { hour = minute = second = 0; }
+                }
+                cfg.atYear = year; cfg.atMonth = month; cfg.atDay = day;
+                cfg.atHour = hour; cfg.atMinute = minute; cfg.atSecond = second;
+                cfg.useAtTime = cfg.useAtDateTime = true;
+                cfg.ms = millisecondsUntilDateTime(year, month, day, hour, minute, second);
+                if (cfg.ms == 0) { textOut() << t(Str::ERROR_PAST_DATETIME) << "\n"; return 1; }
+            } else {
+                // Fall 2: Nur Uhrzeit
+                int parsed = sscanf(first.c_str(), "%d:%d:%d", &cfg.atHour, &cfg.atMinute, &cfg.atSecond);
+                if (parsed < 2) { textOut() << t(Str::ERROR_INVALID_AT) << "\n"; return 1; }
+                if (parsed == 2) cfg.atSecond = 0;
+                cfg.useAtTime = true;
+                cfg.ms = millisecondsUntilTime(cfg.atHour, cfg.atMinute, cfg.atSecond);
+                if (cfg.ms == 0) { textOut() << t(Str::ERROR_NEXT_TIME); return 1; }
+            }
+
+        } else if ((arg == "--open" || arg == "-o") && i + 1 < nArgs) {
+            cfg.openFile = args[++i];
+
+        } else if ((arg == "--cmd" || arg == "-c") && i + 1 < nArgs) {
+            cfg.cmdArg = args[++i];
+
+        } else if ((arg == "--focus" || arg == "-f") && i + 1 < nArgs) {
+            cfg.focusWindow = args[++i];
+
+        } else if ((arg == "--prealarm" || arg == "-pa") && i + 1 < nArgs) {
+            cfg.preAlarmSeconds = safeStoi(args[++i], 0);
+            if (cfg.preAlarmSeconds < 0) cfg.preAlarmSeconds = 0;
+
+        } else if (arg == "--time" || arg == "-t") {
+            cfg.showLiveTime = true;
+
+        } else if (arg == "--stopwatch" || arg == "-sw") {
+            cfg.showStopwatch = true;
+
+        } else if (arg == "--laps" && i + 1 < nArgs) {
+            cfg.lapsFile = args[++i];
+
+        } else if (arg == "--fps" && i + 1 < nArgs) {
+            const string& val = args[++i];
+            cfg.stopwatchFps = safeStoi(val, 0);
+            if (cfg.stopwatchFps < 1 || cfg.stopwatchFps > STOPWATCH_MAX_FPS) {
+                char buf[512];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_FPS), val.c_str(), STOPWATCH_MAX_FPS);
+                textOut() << buf << "\n"; return 1;
+            }
+
+        } else if (arg == "--daily" || arg == "-d") {
+            cfg.useDailyTimes = true;
+            while (i + 1 < nArgs && args[i + 1][0] != '-') {
+                int h = 0, m = 0, s = 0;
+                int parsed = sscanf(args[i + 1].c_str(), "%d:%d:%d", &h, &m, &s);
+                if (parsed < 2) break;
+                ++i;
+                if (parsed == 2) s = 0;
+                cfg.dailyTimes.emplace_back(h, m, s);
+            }
+            if (cfg.dailyTimes.empty()) { textOut() << t(Str::ERROR_NO_DAILY_TIMES) << "\n"; return 1; }
+            cfg.loop = true; cfg.maxLoops = -1;
+
+        } else if ((arg == "--every" || arg == "-e") && i + 1 < nArgs) {
+            string daysStr = args[++i];
+            int h = 0, m = 0, s = 0;
+            if (i + 1 < nArgs && args[i + 1][0] != '-') {
+                int parsed = sscanf(args[i + 1].c_str(), "%d:%d:%d", &h, &m, &s);
+                if (parsed >= 2) { if (parsed == 2) s = 0; ++i; }
+            }
+            cfg.everySpec = parseEverySpec(daysStr, h, m, s);
+            if (cfg.everySpec.days.empty()) {
+                char buf[256]; snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_EVERY), daysStr.c_str());
+                textOut() << buf << "\n"; return 1;
+            }
+            cfg.useEvery = true; cfg.loop = true; cfg.maxLoops = -1;
+            auto target = nextEveryTarget(cfg.everySpec);
+            cfg.ms = chrono::duration_cast<chrono::milliseconds>(
+                         target - chrono::system_clock::now()).count();
+            if (cfg.ms <= 0) cfg.ms = 1000;
+
+        } else if (arg == "--for" && i + 1 < nArgs) {
+            const string& forVal = args[++i];
+            long long parsed = parseTime(forVal);
+            if (parsed > 0) {
+                cfg.forMs  = parsed;
+                cfg.useFor = true;
+            } else {
+                char buf[256];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_FOR), forVal.c_str());
+                textOut() << buf << "\n";
+                return 1;
+            }
+
+        } else if ((arg == "--lang" || arg == "-la") && i + 1 < nArgs) {
+            ++i; // bereits im Vor-Durchlauf verarbeitet
+
+        } else if (arg == "--macro") {
+            // Bereits vollständig behandelt; verbleibende Tokens überspringen.
+            if (i + 1 < nArgs) ++i; // Subbefehl
+            if (i + 1 < nArgs) ++i; // Name
+            if (i + 1 < nArgs) ++i; // Args (bei "add")
+
+        } else if (arg == "--version" || arg == "-v") {
+            textOut() << PRG_VERSION << "\n"; return 0;
+
+        } else if (arg == "--help" || arg == "-h") {
+            textOut() << t(Str::USAGE_HEADER);
+            if (!launchedFromExistingConsole()) {
+                textOut() << "\n" << t(Str::PRESS_ANY_KEY) << "\n" << flush;
+                _getch();
+            }
+            return 0;
+
+        } else if (arg[0] == '-') {
+            char buf[256];
+            snprintf(buf, sizeof(buf), t(Str::ERROR_UNKNOWN_OPTION), arg.c_str());
+            textOut() << buf << "\n"; return 1;
+
+        } else if (!cfg.useAtTime) {
+            bool bareAfterTime = timeTokenSeen && isBareNumber(arg);
+            if (isValidTimeExpression(arg) && !bareAfterTime) {
+                long long possible = parseTime(arg);
+                if (cfg.ms > MAX_MS - possible) cfg.ms = MAX_MS;
+                else cfg.ms += possible;
+                timeTokenSeen = true;
+            } else if (isStandaloneUnit(arg)) {
+                char buf[256];
+                snprintf(buf, sizeof(buf), t(Str::ERROR_DETACHED_UNIT), arg.c_str());
+                textOut() << buf << "\n"; return 1;
+            } else if (cfg.customMsg.empty()) {
+                cfg.customMsg = arg;
+            }
+
+        } else if (cfg.customMsg.empty()) {
+            cfg.customMsg = arg;
+        }
+    }
+    return -1; // weiter zum Timer
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Startmeldung ───────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+static void printStartMessage(const TimerConfig& cfg) {
+    char buf[256];
+    snprintf(buf, sizeof(buf), t(Str::STARTED), PRG_VERSION);
+    cout << buf;
+
+    if (cfg.useAtTime) {
+        if (cfg.useAtDateTime) {
+            snprintf(buf, sizeof(buf), t(Str::TIMER_AT_DATETIME),
+                     cfg.atYear, cfg.atMonth, cfg.atDay,
+                     cfg.atHour, cfg.atMinute, cfg.atSecond);
+        } else {
+            snprintf(buf, sizeof(buf), t(Str::TIMER_AT_TIME),
+                     cfg.atHour, cfg.atMinute, cfg.atSecond);
+        }
+        cout << buf;
+        // Nur innerhalb der sicheren Reichweite direkt auf system_clock::time_point
+        // rechnen (siehe WALL_SAFE_MS). Jenseits davon wuerde "now() + milliseconds(cfg.ms)"
+        // beim Umrechnen auf die intern nanosekunden-basierte MinGW-Implementierung
+        // ueberlaufen (Vorzeichen-Ueberlauf, unbestimmtes Verhalten). Der "(morgen)"-Hinweis
+        // ist bei einem so fernen Ziel ohnehin gegenstandslos, daher wird er schlicht
+        // ausgelassen statt mit einer riskanten Rechnung erzwungen.
+        if (cfg.ms <= WALL_SAFE_MS) {
+            auto   atWallTarget = chrono::system_clock::now() + chrono::milliseconds(cfg.ms);
+            time_t atTargetT    = chrono::system_clock::to_time_t(atWallTarget);
+            if (isTargetTomorrow(atTargetT))
+                cout << t(Str::TOMORROW_SUFFIX);
+        }
+
+    } else if (cfg.useDailyTimes) {
+        cout << t(Str::TIMER_DAILY);
+
+    } else if (cfg.useEvery) {
+        string daysStr = formatEveryDays(cfg.everySpec);
+        snprintf(buf, sizeof(buf), t(Str::TIMER_EVERY),
+                 daysStr.c_str(), cfg.everySpec.hour, cfg.everySpec.minute, cfg.everySpec.second);
+        cout << buf;
+
+    } else {
+        // Countdown: Dauer anzeigen.
+        // Zielzeit (HH:MM:SS) nur bei < 24 Stunden: bei längeren Timern ohne Aussagekraft;
+        // außerdem wäre localtime_s für weit-zukünftige time_t-Werte nicht zuverlässig.
+        string timerStr = formatVerbleibend(cfg.ms / 1000);
+        snprintf(buf, sizeof(buf), t(Str::TIMER_COUNTER), timerStr.c_str());
+        cout << buf;
+
+        if (cfg.ms < 86400000LL) {
+            auto   targetWall = chrono::system_clock::now() + chrono::milliseconds(cfg.ms);
+            time_t targetT    = chrono::system_clock::to_time_t(targetWall);
+            tm     targetTm{};
+            if (localtime_s(&targetTm, &targetT) == 0) {
+                char tbuf[64];
+                snprintf(tbuf, sizeof(tbuf), t(Str::TIMER_TARGET),
+                         targetTm.tm_hour, targetTm.tm_min, targetTm.tm_sec);
+                cout << tbuf;
+            }
+        }
+    }
+
+    if (cfg.asyncSound)
+        cout << t(Str::ASYNC_SUFFIX);
+    if (!cfg.focusWindow.empty()) {
+        snprintf(buf, sizeof(buf), t(Str::FOCUS_TARGET),
+                 toConsole(toWideArgv(cfg.focusWindow)).c_str());
+        cout << buf;
+    }
+    if (!cfg.openFile.empty()) {
+        snprintf(buf, sizeof(buf), t(Str::OPEN_TARGET),
+                 toConsole(toWideArgv(cfg.openFile)).c_str());
+        cout << buf;
+    }
+    cout << "\n";
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Vorab-Prüfungen ────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Prüft vor dem Timer-Start, ob Fenster und Datei bereits erreichbar sind.
+// Warnungen erscheinen einmalig nach der Startmeldung.
+// Rückgabe: false, wenn der Start abgebrochen werden muss (Sounddatei nicht lesbar).
+static bool doPreChecks(const TimerConfig& cfg) {
+    if (!cfg.focusWindow.empty() && !findWindowByTitle(cfg.focusWindow)) {
+        char buf[256];
+        snprintf(buf, sizeof(buf), t(Str::WINDOW_NOT_FOUND_WARN),
+                 toConsole(toWideArgv(cfg.focusWindow)).c_str());
+        textOut() << buf << "\n" << flush;
+    }
+
+    if (!cfg.openFile.empty()) {
+        bool isUrl = cfg.openFile.rfind("http://", 0) == 0 ||
+                     cfg.openFile.rfind("https://", 0) == 0;
+        if (!isUrl) {
+            try {
+                if (!fs::exists(fs::path(cfg.openFile))) {
+                    char buf[256];
+                    snprintf(buf, sizeof(buf), t(Str::FILE_NOT_FOUND_WARN),
+                             toConsole(toWideArgv(cfg.openFile)).c_str());
+                    textOut() << buf << "\n" << flush;
+                }
+            } catch (const fs::filesystem_error&) {
+                // Pfad ungültig; openFileAfterTimer() gibt beim Ablauf eine präzise Meldung.
+            }
+        }
+    }
+
+    // Sounddatei jetzt dekodieren statt erst beim Ablauf. Fehlt sie, meldet
+    // playAlarmSound() das wie bisher; ist sie vorhanden, aber unlesbar, wird abgebrochen.
+    if (!cfg.soundFile.empty() && !cfg.mute) {
+        error_code ec;
+        if (fs::is_regular_file(fs::path(toWideArgv(cfg.soundFile)), ec) && !loadSoundFile(cfg.soundFile)) {
+            char buf[512];
+            snprintf(buf, sizeof(buf), t(Str::ERROR_UNSUPPORTED_SOUND),
+                     toConsole(toWideArgv(cfg.soundFile)).c_str());
+            textOut() << buf << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Stoppuhr-Runden ────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Wie formatVerbleibendTo() mit Hundertsteln; Rückgabe: Länge.
+static int formatStopwatchTo(char* buf, size_t cap, int64_t ns) {
+    long long ms = ns / 1'000'000;
+    char secStr[96];
+    formatVerbleibendTo(secStr, sizeof(secStr), ms / 1000);
+    return snprintf(buf, cap, "%s.%02d", secStr, static_cast<int>((ms % 1000) / 10));
+}
+
+// Zwischenzeiten der Stoppuhr in einem einmalig angelegten Ring. record() ist
+// O(1) und allokiert nie, auch bei sehr schnellen Tastendrücken; ist der Ring
+// voll, fallen die ältesten Runden heraus (Rundennummern zählen weiter).
+class LapRecorder {
+public:
+    static constexpr uint64_t CAPACITY = 1 << 16;
+
+    struct Lap {
+        long long splitNs = 0; // Gesamtzeit seit Start
+        long long lapNs   = 0; // seit der vorherigen Runde
+    };
+
+    static LapRecorder& instance() { static LapRecorder r; return r; }
+
+    // Nur vom Stoppuhr-Thread.
+    void record(chrono::steady_clock::duration split) {
+        long long ns = chrono::duration_cast<chrono::nanoseconds>(split).count();
+        uint64_t  n  = total.load(memory_order_relaxed);
+        laps[n % CAPACITY] = Lap{ ns, ns - lastSplitNs };
+        lastSplitNs = ns;
+        total.store(n + 1, memory_order_release); // Eintrag vor dem Zähler sichtbar
+    }
+
+    void clear() {
+        total.store(0, memory_order_release);
+        lastSplitNs = 0;
+    }
+
+    uint64_t count() const { return total.load(memory_order_acquire); }
+
+    // Runde 'index' (0-basiert); nur gültig für die letzten CAPACITY - 1 Runden.
+    const Lap& at(uint64_t index) const { return laps[index % CAPACITY]; }
+
+    // Exportziel für Esc/Q und Strg+C; leer = kein Export beim Beenden.
+    void setExportPath(const wstring& path) { exportPath = path; }
+    const wstring& exportTarget() const { return exportPath; }
+
+    // Schreibt alle gehaltenen Runden als JSON (Endung .json) oder CSV.
+    // Auch aus dem Strg+C-Handler: liest nur bereits veröffentlichte Einträge
+    // und lässt den ältesten aus, den der Stoppuhr-Thread gerade überschreiben könnte.
+    // Läuft bereits ein Export (Taste E und Strg+C gleichzeitig), liefert sie false.
+    bool exportTo(const wstring& path, uint64_t* written = nullptr) const {
+        if (exportBusy.exchange(true, memory_order_acquire)) return false;
+        struct Done {
+            atomic<bool>& busy;
+            ~Done() { busy.store(false, memory_order_release); }
+        } done{exportBusy};
+
+        FILE* f = path.empty() ? nullptr : _wfopen(path.c_str(), L"w");
+        if (!f) return false;
+        unique_ptr<char[]> fileBuf(new char[1 << 16]); // lebt bis nach fclose()
+        setvbuf(f, fileBuf.get(), _IOFBF, 1 << 16);
+
+        const uint64_t n     = count();
+        const uint64_t first = n > CAPACITY - 1 ? n - (CAPACITY - 1) : 0;
+        size_t dot  = path.find_last_of(L'.');
+        bool   json = dot != wstring::npos && _wcsicmp(path.c_str() + dot, L".json") == 0;
+
+        fputs(json ? "{\"laps\":[" : "lap,lap_ms,split_ms\n", f);
+        for (uint64_t i = first; i < n; ++i) {
+            const Lap& l = at(i);
+            if (json)
+                fprintf(f, "%s\n{\"lap\":%llu,\"lap_ms\":%.3f,\"split_ms\":%.3f}", i > first ? "," : "",
+                        static_cast<unsigned long long>(i + 1), l.lapNs / 1e6, l.splitNs / 1e6);
+            else
+                fprintf(f, "%llu,%.3f,%.3f\n",
+                        static_cast<unsigned long long>(i + 1), l.lapNs / 1e6, l.splitNs / 1e6);
+        }
+        if (json) fputs("\n]}\n", f);
+        bool ok = fclose(f) == 0;
+        if (written) *written = n - first;
+        return ok;
+    }
+
+    bool exporting() const { return exportBusy.load(memory_order_acquire); }
+
+private:
+    LapRecorder() : laps(new Lap[CAPACITY]) {}
+
+    unique_ptr<Lap[]>  laps;
+    atomic<uint64_t>   total{0};
+    long long          lastSplitNs = 0;
+    wstring            exportPath;
+    mutable atomic<bool> exportBusy{false};
+};
+
+// Strg+C in der Stoppuhr: Runden noch nach --laps schreiben.
+static void exportLapsOnInterrupt() {
+    auto& laps = LapRecorder::instance();
+    if (laps.count() == 0 || laps.exportTo(laps.exportTarget())) return;
+    // Exportiert die Stoppuhr gerade selbst: deren Datei fertig schreiben lassen,
+    // bevor der Prozess endet.
+    while (laps.exporting()) Sleep(1);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Interaktive Modi ───────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+static int runLiveClockMode() {
+    system("cls");
+    while (true) {
+        auto   now   = chrono::system_clock::now();
+        time_t tnow  = chrono::system_clock::to_time_t(now);
+        tm     local{};
+        localtime_s(&local, &tnow);
+
+        char timebuf[32];
+        strftime(timebuf, sizeof(timebuf), "%Y-%m-%d %H:%M:%S", &local);
+        g_statusLine.draw(timebuf, static_cast<int>(strlen(timebuf)));
+
+        char titlebuf[48];
+        snprintf(titlebuf, sizeof(titlebuf), "Teefax - %s", timebuf);
+        SetConsoleTitleA(titlebuf);
+
+        auto next = chrono::time_point_cast<chrono::seconds>(now) + chrono::seconds(1);
+        this_thread::sleep_until(next);
+    }
+    return 0; // via Strg+C
+}
+
+// Metronom ohne Zeitangabe: läuft bis Strg+C.
+static int runMetronomeMode(const TimerConfig& cfg) {
+    char buf[256];
+    snprintf(buf, sizeof(buf), t(Str::STARTED), PRG_VERSION);
+    cout << buf << " (" << t(Str::METRONOME_LABEL) << ")\n";
+    snprintf(buf, sizeof(buf), t(Str::METRONOME_HINT),
+             60.0 * MIX_RATE / cfg.clickPeriodSamples, cfg.accentPattern.c_str());
+    cout << buf << "\n" << flush;
+
+    AudioMixer::instance().play(make_shared<ClickTrack>(cfg.clickPeriodSamples, cfg.accentPattern));
+    while (true) this_thread::sleep_for(chrono::hours(1));
+    return 0; // via Strg+C
+}
+
+// Zeichnet mit --fps Bildern pro Sekunde (Standard 100 = jede Hundertstel-
+// sekunde). Die Zeit selbst läuft in voller steady_clock-Auflösung weiter; die
+// Bildrate bestimmt nur, wie oft sie angezeigt wird. Pausiert wird nichts
+// gezeichnet, der Thread schläft bis zum nächsten Tastendruck. Ist das Konsolen-
+// fenster minimiert oder verborgen, sinkt die Anzeige auf 1 Hz.
+// L/Enter nimmt eine Runde auf (Zeitstempel des Tastendrucks); neue Runden
+// erscheinen mit dem nächsten Bild über der Statuszeile, höchstens
+// LAP_LINES_PER_FRAME je Bild. E exportiert sofort, Esc/Q beendet mit Export.
+static int runStopwatchMode(int fps, const string& lapsFile) {
+    using namespace chrono;
+    char buf[256];
+    snprintf(buf, sizeof(buf), t(Str::STARTED), PRG_VERSION);
+    cout << buf << " (" << t(Str::STOPWATCH_LABEL) << ")\n";
+    cout << t(Str::STOPWATCH_HINT) << "\n";
+
+    // Fenstertitel-Kopf einmalig: "Teefax - <Stoppuhr> - "
+    wstring titleHead = L"Teefax - " + toWide(t(Str::STOPWATCH_LABEL)) + L" - ";
+    titleHead.resize(min(titleHead.size(), static_cast<size_t>(64)));
+
+    const auto framePeriod  = duration_cast<steady_clock::duration>(nanoseconds(1'000'000'000LL / fps));
+    const HWND consoleWnd   = GetConsoleWindow();
+    auto&      input        = ConsoleInput::instance();
+    auto       start        = steady_clock::now();
+    bool       isPaused     = false;
+    steady_clock::duration frozen{0}; // Stand beim Pausieren, volle Auflösung
+    long long  lastTitleSec = -1;
+    bool       redraw       = true;
+    int        key          = 0;
+    bool       haveKey      = false;
+
+    // Runden: Ring vorab anlegen, damit die erste Runde nicht allokiert
+    constexpr uint64_t LAP_LINES_PER_FRAME = 16;
+    auto&    laps        = LapRecorder::instance();
+    uint64_t printedLaps = 0;
+    laps.setExportPath(toWideArgv(lapsFile));
+    g_lapsExport.store(!lapsFile.empty());
+
+    // Eine fertige Zeile über der Statuszeile ausgeben; die Statuszeile folgt neu.
+    auto printAbove = [&](const char* text, int len) {
+        g_statusLine.draw(text, min(len, LineRenderer::MAX_LINE - 1));
+        cout.put('\n');
+        g_statusLine.reset();
+        redraw = true;
+    };
+    auto exportLaps = [&](const wstring& path) {
+        uint64_t written = 0;
+        bool     ok      = laps.exportTo(path, &written);
+        char     msg[LineRenderer::MAX_LINE];
+        int      len = ok ? snprintf(msg, sizeof(msg), t(Str::LAPS_SAVED),
+                                     static_cast<unsigned long long>(written), toConsole(path).c_str())
+                          : snprintf(msg, sizeof(msg), t(Str::LAPS_SAVE_FAILED), toConsole(path).c_str());
+        printAbove(msg, len);
+    };
+
+    while (true) {
+        if (haveKey || input.pollKey(key)) {
+            haveKey = false;
+            if (key == 'l' || key == 'L' || key == '\r') {
+                // Zwischenzeit zum Zeitpunkt des Tastendrucks, nicht des Abholens
+                if (!isPaused) laps.record(max(input.keyTime() - start, steady_clock::duration::zero()));
+                redraw = true;
+            } else if (key == 'e' || key == 'E') {
+                exportLaps(lapsFile.empty() ? wstring(L"teefax-laps.csv") : laps.exportTarget());
+            } else if (key == 27 || key == 'q' || key == 'Q') {
+                g_lapsExport.store(false);
+                if (!lapsFile.empty() && laps.count() > 0) {
+                    cout.put('\n');
+                    g_statusLine.reset();
+                    exportLaps(laps.exportTarget());
+                } else {
+                    cout << "\n";
+                }
+                cout << flush;
+                return 0;
+            } else if (key == ' ' || key == 'p' || key == 'P') {
+                auto now = input.keyTime();
+                if (!isPaused) {
+                    isPaused = true;
+                    frozen   = now - start;
+                } else {
+                    start    = now - frozen;
+                    isPaused = false;
+                }
+                redraw = true;
+            } else if (key == 'r' || key == 'R') {
+                isPaused     = true;
+                frozen       = steady_clock::duration::zero();
+                lastTitleSec = -1;
+                redraw       = true;
+                laps.clear();
+                printedLaps  = 0;
+            }
+            continue; // weitere wartende Tasten zuerst
+        }
+
+        auto elapsed = isPaused ? frozen : steady_clock::now() - start;
+        if (redraw || !isPaused) {
+            // Neue Runden über der Statuszeile; bei Tastengewitter nur die letzten
+            const uint64_t lapCount = laps.count();
+            if (lapCount - printedLaps > LAP_LINES_PER_FRAME) {
+                char msg[128];
+                int  len = snprintf(msg, sizeof(msg), t(Str::LAPS_SKIPPED),
+                                    static_cast<unsigned long long>(lapCount - LAP_LINES_PER_FRAME - printedLaps));
+                printAbove(msg, len);
+                printedLaps = lapCount - LAP_LINES_PER_FRAME;
+            }
+            for (; printedLaps < lapCount; ++printedLaps) {
+                const LapRecorder::Lap& lap = laps.at(printedLaps);
+                char lapStr[112], splitStr[112], msg[LineRenderer::MAX_LINE];
+                formatStopwatchTo(lapStr, sizeof(lapStr), lap.lapNs);
+                formatStopwatchTo(splitStr, sizeof(splitStr), lap.splitNs);
+                int len = snprintf(msg, sizeof(msg), t(Str::LAP_LINE),
+                                   static_cast<unsigned long long>(printedLaps + 1), lapStr, splitStr);
+                printAbove(msg, len);
+            }
+
+            long long elapsedMs  = duration_cast<milliseconds>(elapsed).count();
+            long long elapsedSec = elapsedMs / 1000;
+            int       cs         = static_cast<int>((elapsedMs % 1000) / 10);
+
+            char secStr[96];
+            int  secLen = formatVerbleibendTo(secStr, sizeof(secStr), elapsedSec);
+            if (elapsedSec != lastTitleSec) {
+                lastTitleSec = elapsedSec;
+                wchar_t titleW[64 + 96];
+                size_t  n = titleHead.size();
+                wmemcpy(titleW, titleHead.data(), n);
+                for (int i = 0; i < secLen; ++i) titleW[n++] = static_cast<wchar_t>(secStr[i]);
+                titleW[n] = L'\0';
+                SetConsoleTitleW(titleW);
+            }
+
+            char timebuf[112];
+            snprintf(timebuf, sizeof(timebuf), "%s.%02d", secStr, cs);
+            char dispbuf[160];
+            snprintf(dispbuf, sizeof(dispbuf), t(Str::ELAPSED), timebuf);
+            char linebuf[256];
+            int  lineLen = isPaused
+                               ? snprintf(linebuf, sizeof(linebuf), "%s %s", dispbuf, t(Str::STOPWATCH_PAUSED))
+                               : snprintf(linebuf, sizeof(linebuf), "%s", dispbuf);
+            g_statusLine.draw(linebuf, min(lineLen, static_cast<int>(sizeof(linebuf)) - 1));
+            redraw = false;
+        }
+
+        // Pausiert: kein weiteres Bild, schlafen bis zur nächsten Taste
+        if (isPaused) {
+            haveKey = input.waitKey(key, INFINITE);
+            continue;
+        }
+
+        // Nächstes Bild relativ zum Startpunkt – keine Drift. Unsichtbares Fenster:
+        // nur noch zur nächsten vollen Sekunde. Tasten wecken sofort.
+        bool hidden = consoleWnd && (IsIconic(consoleWnd) || !IsWindowVisible(consoleWnd));
+        auto period = hidden ? duration_cast<steady_clock::duration>(seconds(1)) : framePeriod;
+        auto nextFrame = start + (elapsed / period + 1) * period;
+        auto waitMs    = duration_cast<milliseconds>(nextFrame - steady_clock::now()).count();
+        if (waitMs > 0) haveKey = input.waitKey(key, static_cast<DWORD>(waitMs));
+        if (!haveKey) this_thread::sleep_until(nextFrame); // Rest unterhalb einer Millisekunde
+    }
+    return 0; // via Strg+C
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Benannte Stoppuhren (--sw) ─────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Eine benannte Stoppuhr ist nur ein Datensatz in teefax-stopwatches.dat neben
+// der exe; jeder Befehl bildet die Datei ab, ändert einige Bytes und endet. Es
+// läuft kein Prozess mit. Zeiten sind Nanosekunden seit 1970 (system_clock),
+// damit sie Konsole, Prozess und Neustart überdauern.
+struct NamedStopwatchRecord {
+    char    name[32];       // leer = freier Platz
+    int64_t accumulatedNs;  // abgeschlossene Laufabschnitte
+    int64_t runningSinceNs; // 0 = angehalten
+    int64_t lastSplitNs;    // Gesamtzeit bei der letzten Runde
+    int64_t laps;
+};
+
+class NamedStopwatchStore {
+public:
+    static constexpr uint32_t MAGIC = 0x57534654; // "TFSW"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int      SLOTS   = 64;
+
+    ~NamedStopwatchStore() {
+        if (view)  UnmapViewOfFile(view);
+        if (hMap)  CloseHandle(hMap);
+        if (hFile != INVALID_HANDLE_VALUE) CloseHandle(hFile);
+    }
+
+    // Öffnet bzw. legt die Datei an und bildet sie ab. Fremde oder ältere
+    // Formate werden neu initialisiert.
+    bool open() {
+        wstring path = getIniPath();
+        if (path.empty()) return false;
+        path = path.substr(0, path.rfind(L'\\') + 1) + L"teefax-stopwatches.dat";
+        hFile = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE) return false;
+        hMap = CreateFileMappingW(hFile, nullptr, PAGE_READWRITE, 0, sizeof(Layout), nullptr);
+        if (!hMap) return false;
+        view = static_cast<Layout*>(MapViewOfFile(hMap, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(Layout)));
+        if (!view) return false;
+        Lock lk(*this);
+        if (view->magic != MAGIC || view->version != VERSION) {
+            memset(view, 0, sizeof(Layout));
+            view->magic   = MAGIC;
+            view->version = VERSION;
+        }
+        return true;
+    }
+
+    // Prozessübergreifende Sperre über LockFileEx; wird nur für wenige
+    // Mikrosekunden gehalten, auch von der Live-Anzeige.
+    class Lock {
+    public:
+        explicit Lock(NamedStopwatchStore& s) : store(s) {
+            OVERLAPPED ov{};
+            LockFileEx(store.hFile, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &ov);
+        }
+        ~Lock() {
+            OVERLAPPED ov{};
+            UnlockFileEx(store.hFile, 0, MAXDWORD, MAXDWORD, &ov);
+        }
+    private:
+        NamedStopwatchStore& store;
+    };
+
+    // Nur unter Lock. create: freien Platz belegen, falls der Name fehlt.
+    NamedStopwatchRecord* find(const string& name, bool create) {
+        NamedStopwatchRecord* freeSlot = nullptr;
+        for (auto& r : view->records) {
+            if (r.name[0] == '\0') { if (!freeSlot) freeSlot = &r; continue; }
+            if (strncmp(r.name, name.c_str(), sizeof(r.name)) == 0) return &r;
+        }
+        if (!create || !freeSlot) return nullptr;
+        *freeSlot = NamedStopwatchRecord{};
+        memcpy(freeSlot->name, name.c_str(), name.size() + 1);
+        return freeSlot;
+    }
+
+    static int64_t nowNs() {
+        return chrono::duration_cast<chrono::nanoseconds>(
+            chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    static int64_t elapsedNs(const NamedStopwatchRecord& r, int64_t now) {
+        return r.accumulatedNs + (r.runningSinceNs ? max<int64_t>(0, now - r.runningSinceNs) : 0);
+    }
+
+private:
+    struct Layout {
+        uint32_t             magic;
+        uint32_t             version;
+        NamedStopwatchRecord records[SLOTS];
+    };
+
+    HANDLE  hFile = INVALID_HANDLE_VALUE;
+    HANDLE  hMap  = nullptr;
+    Layout* view  = nullptr;
+};
+
+// Name einer benannten Stoppuhr: 1 bis 31 Zeichen aus Buchstaben, Ziffern, - _ .
+static bool isStopwatchNameValid(const string& name) {
+    if (name.empty() || name.size() >= sizeof(NamedStopwatchRecord::name)) return false;
+    for (char c : name)
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_' && c != '.') return false;
+    return true;
+}
+
+// "<name>: <Zeit>[ [PAUSIERT]]" für einen Datensatz (Kopie, außerhalb der Sperre).
+static int formatNamedStopwatchLine(char* buf, size_t cap, const NamedStopwatchRecord& r, int64_t now) {
+    char timeStr[112];
+    formatStopwatchTo(timeStr, sizeof(timeStr), NamedStopwatchStore::elapsedNs(r, now));
+    int n = snprintf(buf, cap, "%s: %s%s%s", r.name, timeStr,
+                     r.runningSinceNs ? "" : " ", r.runningSinceNs ? "" : t(Str::STOPWATCH_PAUSED));
+    return min(n, static_cast<int>(cap) - 1);
+}
+
+// --sw <name> [start|stop|lap|reset|remove|show]: wie --macro vor dem eigentlichen
+// Parser ausgewertet. Rückgabe: -1 = kein --sw, sonst Exit-Code.
+static int handleNamedStopwatch(const vector<string>& args) {
+    const int n = static_cast<int>(args.size());
+    int i = 0;
+    while (i < n && args[i] != "--sw") ++i;
+    if (i == n) return -1;
+
+    char buf[LineRenderer::MAX_LINE];
+    if (i + 1 >= n) { cout << t(Str::SW_MISSING_NAME) << "\n"; return 1; }
+    const string& name   = args[i + 1];
+    const string  subcmd = i + 2 < n ? args[i + 2] : "show";
+    if (!isStopwatchNameValid(name)) {
+        snprintf(buf, sizeof(buf), t(Str::SW_INVALID_NAME), name.c_str());
+        cout << buf << "\n"; return 1;
+    }
+    if (subcmd != "start" && subcmd != "stop" && subcmd != "lap" &&
+        subcmd != "reset" && subcmd != "remove" && subcmd != "show") {
+        snprintf(buf, sizeof(buf), t(Str::SW_INVALID_SUBCMD), subcmd.c_str());
+        cout << buf << "\n"; return 1;
+    }
+
+    NamedStopwatchStore store;
+    if (!store.open()) { cout << t(Str::SW_STORE_ERROR) << "\n"; return 1; }
+
+    // Befehl unter der Sperre ausführen und den Datensatz für die Ausgabe kopieren
+    NamedStopwatchRecord snapshot{};
+    int64_t lapNs = 0;
+    int64_t now   = NamedStopwatchStore::nowNs();
+    {
+        NamedStopwatchStore::Lock lk(store);
+        NamedStopwatchRecord* r = store.find(name, subcmd == "start");
+        if (!r) {
+            snprintf(buf, sizeof(buf), t(subcmd == "start" ? Str::SW_STORE_FULL : Str::SW_NOT_FOUND),
+                     name.c_str());
+            cout << buf << "\n"; return 1;
+        }
+        if (subcmd == "start") {
+            if (!r->runningSinceNs) r->runningSinceNs = now;
+        } else if (subcmd == "stop") {
+            r->accumulatedNs  = NamedStopwatchStore::elapsedNs(*r, now);
+            r->runningSinceNs = 0;
+        } else if (subcmd == "lap") {
+            int64_t split  = NamedStopwatchStore::elapsedNs(*r, now);
+            lapNs          = split - r->lastSplitNs;
+            r->lastSplitNs = split;
+            ++r->laps;
+        } else if (subcmd == "reset") {
+            r->accumulatedNs  = 0;
+            r->runningSinceNs = r->runningSinceNs ? now : 0;
+            r->lastSplitNs    = 0;
+            r->laps           = 0;
+        }
+        snapshot = *r;
+        if (subcmd == "remove") *r = NamedStopwatchRecord{};
+    }
+
+    if (subcmd == "remove") {
+        snprintf(buf, sizeof(buf), t(Str::SW_REMOVED), name.c_str());
+        cout << buf << "\n";
+        return 0;
+    }
+    if (subcmd == "lap") {
+        char lapStr[112], splitStr[112], line[LineRenderer::MAX_LINE];
+        formatStopwatchTo(lapStr, sizeof(lapStr), lapNs);
+        formatStopwatchTo(splitStr, sizeof(splitStr), snapshot.lastSplitNs);
+        snprintf(line, sizeof(line), t(Str::LAP_LINE),
+                 static_cast<unsigned long long>(snapshot.laps), lapStr, splitStr);
+        cout << snapshot.name << ": " << line << "\n";
+        return 0;
+    }
+
+    // show auf einer Konsole bei laufender Uhr: live anzeigen, bis Esc/Q oder Strg+C.
+    // Jedes Bild liest den Datensatz neu; Start/Stopp aus anderen Konsolen wirkt sofort.
+    DWORD outMode = 0;
+    if (subcmd != "show" || !snapshot.runningSinceNs ||
+        !GetConsoleMode(GetStdHandle(STD_OUTPUT_HANDLE), &outMode)) {
+        formatNamedStopwatchLine(buf, sizeof(buf), snapshot, now);
+        cout << buf << "\n";
+        return 0;
+    }
+    auto& input = ConsoleInput::instance();
+    input.start();
+    const auto framePeriod = chrono::milliseconds(1000 / STOPWATCH_MAX_FPS);
+    auto       nextFrame   = chrono::steady_clock::now();
+    for (;;) {
+        {
+            NamedStopwatchStore::Lock lk(store);
+            NamedStopwatchRecord* r = store.find(name, false);
+            if (!r) break; // aus einer anderen Konsole entfernt
+            snapshot = *r;
+        }
+        g_statusLine.draw(buf, formatNamedStopwatchLine(buf, sizeof(buf), snapshot,
+                                                        NamedStopwatchStore::nowNs()));
+        // Angehalten (etwa aus einer anderen Konsole): nur noch viermal pro Sekunde nachsehen
+        nextFrame += snapshot.runningSinceNs ? framePeriod : chrono::milliseconds(250);
+        auto waitMs = chrono::duration_cast<chrono::milliseconds>(nextFrame - chrono::steady_clock::now()).count();
+        if (waitMs < 0) { nextFrame = chrono::steady_clock::now(); waitMs = 0; }
+        int key = 0;
+        if (input.waitKey(key, static_cast<DWORD>(waitMs)) && (key == 27 || key == 'q' || key == 'Q'))
+            break;
+    }
+    cout << "\n" << flush;
+    return 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Fortschrittsbalken ─────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Berechnet die verfügbare Balkenbreite anhand der (zwischengespeicherten) Konsolenbreite.
+// prefixCols ist die Anzeigebreite des Präfixes (displayWidth), nicht seine Bytelänge.
+// Verhindert Zeilenumbrüche in schmalen Fenstern; gibt 0 zurück wenn kein Platz.
+static int calcEffectiveBarWidth(int prefixCols, int maxBarWidth) {
+    int cols = ConsoleInput::instance().width();
+    if (cols <= 0) return maxBarWidth;
+    int w = cols - prefixCols - 13;
+    if (w < 0) return 0;
+    return (w > maxBarWidth) ? maxBarWidth : w;
+}
 
-        } else if ((arg == "--sound" || arg == "-s") && i + 1 < nArgs) {
-            cfg.soundFile = args[++i];
+// Baut den Präfix-Text auf: ggf. Schleifenzähler + verbleibende Zeit + "morgen"-Suffix.
+// Schreibt in einen festen Puffer (keine Allokation im Tick); Rückgabe: Länge.
+static int buildBarPrefix(char* buf, size_t cap, bool loop, long long loopCount,
+                          const char* verbleibendStr, time_t wallTargetT) {
+    int n = 0;
+    auto append = [&](int written) {
+        if (written > 0) n = min(n + written, static_cast<int>(cap) - 1);
+    };
+    if (loop)
+        append(snprintf(buf + n, cap - n, t(Str::LOOP_PREFIX), loopCount));
+    append(snprintf(buf + n, cap - n, t(Str::REMAINING), verbleibendStr));
+    if (wallTargetT != 0 && isTargetTomorrow(wallTargetT))
+        append(snprintf(buf + n, cap - n, "%s", t(Str::TOMORROW_SUFFIX)));
+    return n;
+}
 
-        } else if ((arg == "--alarm-repeat" || arg == "-ar") && i + 1 < nArgs) {
-            const string& val = args[++i];
-            try {
-                size_t pos = 0;
-                cfg.alarmRepeat = stoll(val, &pos, 10);
-                if (pos != val.size() || cfg.alarmRepeat < 0) {
-                    cfg.alarmRepeat = 1;
-                    char w[256]; snprintf(w, sizeof(w), t(Str::WARN_ALARM_REPEAT_INVALID), val.c_str()); fprintf(stderr, "%s\n", w);
-                }
-            } catch (const std::out_of_range&) {
-                cfg.alarmRepeat = std::numeric_limits<long long>::max();
-                char w[256]; snprintf(w, sizeof(w), t(Str::WARN_ALARM_REPEAT_TOO_LARGE), val.c_str(), cfg.alarmRepeat); fprintf(stderr, "%s\n", w);
-            } catch (...) {
-                cfg.alarmRepeat = 1;
-                char w[256]; snprintf(w, sizeof(w), t(Str::WARN_ALARM_REPEAT_INVALID), val.c_str()); fprintf(stderr, "%s\n", w);
+// Unterteilungen je Balkenzelle: --bar smooth nutzt die Achtelblöcke U+2589..U+258F
+constexpr int SMOOTH_BAR_STEPS = 8;
+// Kürzester Abstand zweier Balken-Frames (~60 Hz) bei sehr kurzen Timern
+constexpr long long BAR_MIN_FRAME_MS = 16;
+
+// Setzt Präfix und Fortschrittsbalken zu einer Zeile zusammen (UTF-8); Rückgabe: Länge.
+// filled zählt ganze Zellen, bei smooth Achtelzellen; filled == total (* 8) ergibt
+// einen vollen Balken.
+static int composeBarLine(char* line, const char* prefix, int prefixLen,
+                          int filled, int total, bool smooth) {
+    int n = min(prefixLen, LineRenderer::MAX_LINE - 3);
+    memcpy(line, prefix, static_cast<size_t>(n));
+    const int cellBytes = smooth ? 3 : 1;
+    if (total > 0 && n + total * cellBytes + 3 <= LineRenderer::MAX_LINE) {
+        line[n++] = ' ';
+        line[n++] = '[';
+        if (!smooth) {
+            for (int i = 0; i < total; ++i) line[n++] = (i < filled ? '#' : '-');
+        } else {
+            int full = filled / SMOOTH_BAR_STEPS, part = filled % SMOOTH_BAR_STEPS;
+            for (int i = 0; i < total; ++i) {
+                int eighths = i < full ? SMOOTH_BAR_STEPS : (i == full ? part : 0);
+                if (eighths == 0) { line[n++] = ' '; continue; }
+                // U+2588 = voller Block, U+258F = 1/8: 8 - eighths Schritte dahinter
+                line[n++] = '\xE2';
+                line[n++] = '\x96';
+                line[n++] = static_cast<char>(0x88 + (SMOOTH_BAR_STEPS - eighths));
             }
+        }
+        line[n++] = ']';
+    }
+    return n;
+}
 
-        } else if ((arg == "--alarm-interval" || arg == "-ai") && i + 1 < nArgs) {
-            cfg.alarmInterval = safeStoi(args[++i], 2);
-            if (cfg.alarmInterval < 1) cfg.alarmInterval = 1;
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Anzeige-Thread ─────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
 
-        } else if (arg == "--async" || arg == "-as") {
-            cfg.asyncSound = true;
+// Briefkasten mit genau einem Platz für den jeweils neuesten Zustand (Dreifach-
+// puffer): ein Schreiber, ein Leser, keine Sperren. Der Schreiber füllt back()
+// und tauscht ihn per publish() gegen den mittleren Puffer; der Leser holt sich
+// mit take() den mittleren, falls er neu ist. Liest der Leser zu langsam, über-
+// schreibt der nächste publish() den ungelesenen Zustand – Frames fallen weg,
+// der Schreiber wartet nie.
+template <typename T>
+class LatestSlot {
+public:
+    T& back() { return bufs[backIdx]; }
+
+    void publish() {
+        backIdx = middle.exchange(backIdx | FRESH, memory_order_acq_rel) & INDEX_MASK;
+    }
 
-        } else if ((arg == "--at" || arg == "-a" || arg == "--until") && i + 1 < nArgs) {
-            string first = args[++i];
-            long long year; // long long: %d/int wuerde Jahreszahlen jenseits ~2,147 Mrd. lautlos verfaelschen
-            int month, day;
-            int hour = 0, minute = 0, second = 0;
+    // nullptr, wenn seit dem letzten Aufruf nichts veröffentlicht wurde.
+    const T* take() {
+        if (!(middle.load(memory_order_acquire) & FRESH)) return nullptr;
+        frontIdx = middle.exchange(frontIdx, memory_order_acq_rel) & INDEX_MASK;
+        return &bufs[frontIdx];
+    }
 
-            if (sscanf(first.c_str(), "%lld-%d-%d", &year, &month, &day) == 3) {
-                // Fall 1: Datum erkannt – optionale Uhrzeit prüfen
-                if (i + 1 < nArgs && args[i + 1][0] != '-') {
-                    int parsed = sscanf(args[i + 1].c_str(), "%d:%d:%d", &hour, &minute, &second);
-                    if (parsed >= 2) { if (parsed == 2) second = 0; ++i; }
-                    else { hour = minute = second = 0; }
-                }
-                cfg.atYear = year; cfg.atMonth = month; cfg.atDay = day;
-                cfg.atHour = hour; cfg.atMinute = minute; cfg.atSecond = second;
-                cfg.useAtTime = cfg.useAtDateTime = true;
-                cfg.ms = millisecondsUntilDateTime(year, month, day, hour, minute, second);
-                if (cfg.ms == 0) { cout << t(Str::ERROR_PAST_DATETIME) << "\n"; return 1; }
-            } else {
-                // Fall 2: Nur Uhrzeit
-                int parsed = sscanf(first.c_str(), "%d:%d:%d", &cfg.atHour, &cfg.atMinute, &cfg.atSecond);
-                if (parsed < 2) { cout << t(Str::ERROR_INVALID_AT) << "\n"; return 1; }
-                if (parsed == 2) cfg.atSecond = 0;
-                cfg.useAtTime = true;
-                cfg.ms = millisecondsUntilTime(cfg.atHour, cfg.atMinute, cfg.atSecond);
-                if (cfg.ms == 0) { cout << t(Str::ERROR_NEXT_TIME); return 1; }
-            }
+private:
+    static constexpr int FRESH      = 4;
+    static constexpr int INDEX_MASK = 3;
 
-        } else if ((arg == "--open" || arg == "-o") && i + 1 < nArgs) {
-            cfg.openFile = args[++i];
+    T           bufs[3]{};
+    int         backIdx  = 0; // nur Schreiber
+    int         frontIdx = 1; // nur Leser
+    atomic<int> middle{2};
+};
 
-        } else if ((arg == "--cmd" || arg == "-c") && i + 1 < nArgs) {
-            cfg.cmdArg = args[++i];
+// Zustand eines Countdown-Frames. Die Tick-Schleife formatiert nur die Restzeit;
+// Präfix, Layout, Balken und Fenstertitel entstehen im Anzeige-Thread.
+struct StatusFrame {
+    long long loopCount   = 0;
+    time_t    wallTargetT = 0;
+    double    fraction    = 0.0; // 0..1
+    bool      loop        = false;
+    bool      setTitle    = false;
+    bool      newline     = false; // nach dem Frame Zeilenumbruch ausgeben
+    char      remaining[96]{};
+    int       remainingLen = 0;
+};
 
-        } else if ((arg == "--focus" || arg == "-f") && i + 1 < nArgs) {
-            cfg.focusWindow = args[++i];
+// Zeichnet die Countdown-Statuszeile in einem eigenen Thread niedriger Priorität.
+// Konsolenausgabe und SetConsoleTitleW können blockieren (QuickEdit-Markierung,
+// angehaltene Remote-Sitzung, langsames conhost); der TIME_CRITICAL-Thread der
+// Tick-Schleife veröffentlicht daher nur noch den Zustand und kehrt sofort zu
+// seinen Fristen zurück. Eine eingefrorene Konsole verzögert so nie den Alarm.
+class StatusRenderer {
+public:
+    static constexpr int BAR_WIDTH      = 30;
+    static constexpr int FLUSH_WAIT_MS  = 2000;
+
+    static StatusRenderer& instance() { static StatusRenderer r; return r; }
+
+    // Startet den Thread (einmalig). titleTail: " | <Notiz>" oder leer.
+    void start(const wchar_t* titleTail, int titleTailLen, bool smoothBar) {
+        if (wakeEvent) return;
+        smooth = smoothBar;
+        tailLen = min(titleTailLen, static_cast<int>(size(tail)) - 1);
+        wmemcpy(tail, titleTail, static_cast<size_t>(tailLen));
+        wakeEvent  = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        drawnEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        thread([this]{ threadMain(); }).detach(); // wartet bis Programmende auf Frames
+    }
 
-        } else if ((arg == "--prealarm" || arg == "-pa") && i + 1 < nArgs) {
-            cfg.preAlarmSeconds = safeStoi(args[++i], 0);
-            if (cfg.preAlarmSeconds < 0) cfg.preAlarmSeconds = 0;
+    // Nur vom Tick-Thread: Frame füllen, dann publish().
+    StatusFrame& frame() { return slot.back(); }
 
-        } else if (arg == "--time" || arg == "-t") {
-            cfg.showLiveTime = true;
+    void publish() {
+        slot.publish();
+        publishedSeq.fetch_add(1, memory_order_release);
+        SetEvent(wakeEvent);
+    }
 
-        } else if (arg == "--stopwatch" || arg == "-sw") {
-            cfg.showStopwatch = true;
+    // Nächster Frame vollständig neu zeichnen (fremde Ausgabe seit dem letzten).
+    void reset() { resetPending.store(true, memory_order_release); }
+
+    // Sichtbare Balkenschritte (Zellen, bei --bar smooth Achtelzellen) des zuletzt
+    // gezeichneten Layouts; 0 = kein Balken. Die Tick-Schleife weckt sich damit
+    // genau dann, wenn sich der Balken sichtbar ändert.
+    int resolution() const { return barSteps.load(memory_order_relaxed); }
+
+    // Wartet, bis alle veröffentlichten Frames gezeichnet sind – vor eigener
+    // Ausgabe des Tick-Threads. Begrenzt: bei eingefrorener Konsole geht es weiter.
+    void flush() {
+        if (!wakeEvent) return;
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(FLUSH_WAIT_MS);
+        while (drawnSeq.load(memory_order_acquire) != publishedSeq.load(memory_order_acquire)) {
+            auto left = chrono::duration_cast<chrono::milliseconds>(
+                deadline - chrono::steady_clock::now()).count();
+            if (left <= 0) break;
+            WaitForSingleObject(drawnEvent, static_cast<DWORD>(left));
+        }
+    }
 
-        } else if (arg == "--daily" || arg == "-d") {
-            cfg.useDailyTimes = true;
-            while (i + 1 < nArgs && args[i + 1][0] != '-') {
-                int h = 0, m = 0, s = 0;
-                int parsed = sscanf(args[i + 1].c_str(), "%d:%d:%d", &h, &m, &s);
-                if (parsed < 2) break;
-                ++i;
-                if (parsed == 2) s = 0;
-                cfg.dailyTimes.emplace_back(h, m, s);
+private:
+    StatusRenderer() = default;
+
+    void threadMain() {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+        static constexpr wchar_t head[] = L"Teefax - ";
+        constexpr int HEAD = static_cast<int>(size(head)) - 1;
+        for (;;) {
+            WaitForSingleObject(wakeEvent, INFINITE);
+            // Sequenz vor take() lesen: alles bis hierhin ist danach gezeichnet
+            unsigned seq = publishedSeq.load(memory_order_acquire);
+            if (const StatusFrame* f = slot.take()) {
+                if (resetPending.exchange(false, memory_order_acq_rel)) line.reset();
+                draw(*f);
+                if (f->setTitle) {
+                    wchar_t titleW[HEAD + sizeof(f->remaining) + size(tail)];
+                    wmemcpy(titleW, head, HEAD);
+                    int n = HEAD;
+                    for (int i = 0; i < f->remainingLen; ++i) // Restzeit ist reines ASCII
+                        titleW[n++] = static_cast<wchar_t>(f->remaining[i]);
+                    wmemcpy(titleW + n, tail, static_cast<size_t>(tailLen));
+                    n += tailLen;
+                    titleW[n] = L'\0';
+                    SetConsoleTitleW(titleW);
+                }
             }
-            if (cfg.dailyTimes.empty()) { cout << t(Str::ERROR_NO_DAILY_TIMES) << "\n"; return 1; }
-            cfg.loop = true; cfg.maxLoops = -1;
+            drawnSeq.store(seq, memory_order_release);
+            SetEvent(drawnEvent);
+        }
+    }
 
-        } else if ((arg == "--every" || arg == "-e") && i + 1 < nArgs) {
-            string daysStr = args[++i];
-            int h = 0, m = 0, s = 0;
-            if (i + 1 < nArgs && args[i + 1][0] != '-') {
-                int parsed = sscanf(args[i + 1].c_str(), "%d:%d:%d", &h, &m, &s);
-                if (parsed >= 2) { if (parsed == 2) s = 0; ++i; }
-            }
-            cfg.everySpec = parseEverySpec(daysStr, h, m, s);
-            if (cfg.everySpec.days.empty()) {
-                char buf[256]; snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_EVERY), daysStr.c_str());
-                cout << buf << "\n"; return 1;
-            }
-            cfg.useEvery = true; cfg.loop = true; cfg.maxLoops = -1;
-            auto target = nextEveryTarget(cfg.everySpec);
-            cfg.ms = chrono::duration_cast<chrono::milliseconds>(
-                         target - chrono::system_clock::now()).count();
-            if (cfg.ms <= 0) cfg.ms = 1000;
+    void draw(const StatusFrame& f) {
+        char prefix[256];
+        int  prefixLen = buildBarPrefix(prefix, sizeof(prefix), f.loop, f.loopCount,
+                                        f.remaining, f.wallTargetT);
+        // Layout nur neu berechnen, wenn sich Fensterbreite oder Präfixbreite ändern
+        int prefixCols = displayWidth(prefix, static_cast<size_t>(prefixLen));
+        unsigned gen   = ConsoleInput::instance().generation();
+        if (gen != layoutGen || prefixCols != layoutPrefixCols) {
+            layoutGen        = gen;
+            layoutPrefixCols = prefixCols;
+            effBar           = calcEffectiveBarWidth(prefixCols, BAR_WIDTH);
+            barSteps.store(effBar * (smooth ? SMOOTH_BAR_STEPS : 1), memory_order_relaxed);
+        }
+        const int steps  = effBar * (smooth ? SMOOTH_BAR_STEPS : 1);
+        const int filled = min(static_cast<int>(f.fraction * steps), steps);
+        char text[LineRenderer::MAX_LINE];
+        line.draw(text, composeBarLine(text, prefix, prefixLen, filled, effBar, smooth));
+        if (f.newline) {
+            cout.put('\n').flush();
+            line.reset();
+        }
+    }
 
-        } else if (arg == "--for" && i + 1 < nArgs) {
-            const string& forVal = args[++i];
-            long long parsed = parseTime(forVal);
-            if (parsed > 0) {
-                cfg.forMs  = parsed;
-                cfg.useFor = true;
-            } else {
-                char buf[256];
-                snprintf(buf, sizeof(buf), t(Str::ERROR_INVALID_FOR), forVal.c_str());
-                cout << buf << "\n";
-                return 1;
-            }
+    LatestSlot<StatusFrame> slot;
+    LineRenderer     line;
+    HANDLE           wakeEvent  = nullptr;
+    HANDLE           drawnEvent = nullptr;
+    atomic<unsigned> publishedSeq{0};
+    atomic<unsigned> drawnSeq{0};
+    atomic<bool>     resetPending{false};
+    atomic<int>      barSteps{0};
+    bool             smooth = false;
+    wchar_t          tail[40]{};
+    int              tailLen          = 0;
+    int              effBar           = 0; // Balkenbreite; neu nur bei Layoutänderung
+    unsigned         layoutGen        = ~0u;
+    int              layoutPrefixCols = -1;
+};
 
-        } else if ((arg == "--lang" || arg == "-la") && i + 1 < nArgs) {
-            ++i; // bereits im Vor-Durchlauf verarbeitet
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Ereignisstrom (--output jsonl) ─────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
 
-        } else if (arg == "--macro") {
-            // Bereits vollständig behandelt; verbleibende Tokens überspringen.
-            if (i + 1 < nArgs) ++i; // Subbefehl
-            if (i + 1 < nArgs) ++i; // Name
-            if (i + 1 < nArgs) ++i; // Args (bei "add")
+// Eine JSON-Zeile in einem festen Puffer. Schlüssel sind Literale, Texte werden
+// maskiert; keine Allokation, damit auch der Tick Ereignisse schreiben kann.
+class JsonLine {
+public:
+    static constexpr int CAP = 1024;
 
-        } else if (arg == "--version" || arg == "-v") {
-            cout << PRG_VERSION << "\n"; return 0;
+    explicit JsonLine(const char* event) {
+        raw("{\"event\":\"");
+        raw(event);
+        raw("\"");
+    }
 
-        } else if (arg == "--help" || arg == "-h") {
-            cout << t(Str::USAGE_HEADER);
-            if (!launchedFromExistingConsole()) {
-                cout << "\n" << t(Str::PRESS_ANY_KEY) << "\n" << flush;
-                _getch();
-            }
-            return 0;
+    JsonLine& num(const char* key, long long v) {
+        name(key);
+        if (n + 24 < CAP) n = static_cast<int>(to_chars(buf + n, buf + CAP, v).ptr - buf);
+        return *this;
+    }
 
-        } else if (arg[0] == '-') {
-            char buf[256];
-            snprintf(buf, sizeof(buf), t(Str::ERROR_UNKNOWN_OPTION), arg.c_str());
-            cout << buf << "\n"; return 1;
+    JsonLine& real(const char* key, double v) {
+        name(key);
+        if (n + 32 < CAP) n += snprintf(buf + n, CAP - n, "%.6f", v);
+        return *this;
+    }
 
-        } else if (!cfg.useAtTime) {
-            bool bareAfterTime = timeTokenSeen && isBareNumber(arg);
-            if (isValidTimeExpression(arg) && !bareAfterTime) {
-                long long possible = parseTime(arg);
-                if (cfg.ms > MAX_MS - possible) cfg.ms = MAX_MS;
-                else cfg.ms += possible;
-                timeTokenSeen = true;
-            } else if (isStandaloneUnit(arg)) {
-                char buf[256];
-                snprintf(buf, sizeof(buf), t(Str::ERROR_DETACHED_UNIT), arg.c_str());
-                cout << buf << "\n"; return 1;
-            } else if (cfg.customMsg.empty()) {
-                cfg.customMsg = arg;
-            }
+    JsonLine& flag(const char* key, bool v) {
+        name(key);
+        raw(v ? "true" : "false");
+        return *this;
+    }
 
-        } else if (cfg.customMsg.empty()) {
-            cfg.customMsg = arg;
+    // UTF-8-Text; Anführungszeichen, Backslash und Steuerzeichen werden maskiert.
+    JsonLine& str(const char* key, const char* v) {
+        name(key);
+        raw("\"");
+        for (; *v && n + 96 < CAP; ++v) { // zu lange Texte kürzen, Platz für weitere Felder lassen
+            unsigned char c = static_cast<unsigned char>(*v);
+            if (c == '"' || c == '\\') { buf[n++] = '\\'; buf[n++] = static_cast<char>(c); }
+            else if (c < 0x20)         n += snprintf(buf + n, CAP - n, "\\u%04x", c);
+            else                       buf[n++] = static_cast<char>(c);
         }
+        raw("\"");
+        return *this;
     }
-    return -1; // weiter zum Timer
+
+    // Schließt die Zeile ab; Rückgabe: Länge inklusive "}\n".
+    int finish() {
+        if (n > CAP - 2) n = CAP - 2;
+        buf[n++] = '}';
+        buf[n++] = '\n';
+        return n;
+    }
+
+    const char* data() const { return buf; }
+
+private:
+    void raw(const char* s) {
+        while (*s && n < CAP - 2) buf[n++] = *s++;
+    }
+    void name(const char* key) {
+        raw(",\"");
+        raw(key);
+        raw("\":");
+    }
+
+    char buf[CAP];
+    int  n = 0;
+};
+
+// Maschinenlesbare Ereignisse auf stdout, eine JSON-Zeile pro Ereignis, jeweils
+// mit monotonem (mono_ms, seit Programmstart) und Wanduhr-Zeitstempel (wall_ms,
+// Unix-Epoche). Ohne Übersetzung, ohne Steuersequenzen. Gesammelt wird in einem
+// eigenen Puffer: Ticks werden nie einzeln geschrieben, erst ein Lebenszyklus-
+// Ereignis (started, loop, prealarm, fired, action, stopped) leert ihn.
+class EventStream {
+public:
+    static EventStream& instance() { static EventStream s; return s; }
+
+    void enable() {
+        active = true;
+        epoch  = chrono::steady_clock::now();
+    }
+    bool enabled() const { return active; }
+
+    // Neue Zeile mit Ereignisname und beiden Zeitstempeln.
+    JsonLine begin(const char* event) const {
+        using namespace chrono;
+        JsonLine line(event);
+        line.num("mono_ms", duration_cast<milliseconds>(steady_clock::now() - epoch).count());
+        line.num("wall_ms", duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+        return line;
+    }
+
+    void emit(JsonLine& line, bool flushNow = true) {
+        int len = line.finish();
+        lock_guard<mutex> lk(mtx); // Strg+C-Handler schreibt aus eigenem Thread
+        if (used + len > sizeof(buf)) drain();
+        memcpy(buf + used, line.data(), static_cast<size_t>(len));
+        used += len;
+        if (flushNow) { drain(); cout.flush(); }
+    }
+
+    // Durchlauf-Nummer für das stopped-Ereignis des Strg+C-Handlers.
+    atomic<long long> iteration{0};
+
+private:
+    EventStream() = default;
+
+    void drain() {
+        cout.write(buf, static_cast<streamsize>(used));
+        used = 0;
+    }
+
+    bool   active = false;
+    chrono::steady_clock::time_point epoch;
+    mutex  mtx;
+    char   buf[64 * 1024];
+    size_t used = 0;
+};
+
+static void emitInterruptedEvent() {
+    auto& events = EventStream::instance();
+    if (!events.enabled()) return;
+    JsonLine line = events.begin("stopped");
+    line.str("reason", "interrupted").num("iterations", events.iteration.load());
+    events.emit(line);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
-// ── Startmeldung ───────────────────────────────────────────────────────────
+// ── Timer-Register (--status, --attach) ────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════
 
-static void printStartMessage(const TimerConfig& cfg) {
-    char buf[256];
-    snprintf(buf, sizeof(buf), t(Str::STARTED), PRG_VERSION);
-    cout << buf;
+enum class TimerState : uint32_t { Starting = 0, Running, Paused, Alarm };
+
+// Veröffentlichter Zustand eines laufenden Timers. Die Restzeit ergibt sich beim
+// Leser aus deadlineWallMs; der Timer schreibt nur bei Zustandswechseln
+// (Durchlaufbeginn, Pause, +1 Minute, Alarm), nie im Tick.
+struct TimerStatus {
+    int64_t    deadlineWallMs = 0;  // Zielzeit in ms seit 1970 (nur Running)
+    int64_t    remainingMs    = 0;  // eingefrorene Restzeit (Paused)
+    int64_t    totalMs        = 0;  // Länge des Durchlaufs, für den Balken
+    int64_t    loopCount      = 0;
+    TimerState state          = TimerState::Starting;
+    uint32_t   loop           = 0;
+    char       mode[12]{};          // countdown, at, daily, every
+    char       label[64]{};         // Notiz, UTF-8
+};
 
-    if (cfg.useAtTime) {
-        if (cfg.useAtDateTime) {
-            snprintf(buf, sizeof(buf), t(Str::TIMER_AT_DATETIME),
-                     cfg.atYear, cfg.atMonth, cfg.atDay,
-                     cfg.atHour, cfg.atMinute, cfg.atSecond);
-        } else {
-            snprintf(buf, sizeof(buf), t(Str::TIMER_AT_TIME),
-                     cfg.atHour, cfg.atMinute, cfg.atSecond);
-        }
-        cout << buf;
-        // Nur innerhalb der sicheren Reichweite direkt auf system_clock::time_point
-        // rechnen (siehe WALL_SAFE_MS). Jenseits davon wuerde "now() + milliseconds(cfg.ms)"
-        // beim Umrechnen auf die intern nanosekunden-basierte MinGW-Implementierung
-        // ueberlaufen (Vorzeichen-Ueberlauf, unbestimmtes Verhalten). Der "(morgen)"-Hinweis
-        // ist bei einem so fernen Ziel ohnehin gegenstandslos, daher wird er schlicht
-        // ausgelassen statt mit einer riskanten Rechnung erzwungen.
-        if (cfg.ms <= WALL_SAFE_MS) {
-            auto   atWallTarget = chrono::system_clock::now() + chrono::milliseconds(cfg.ms);
-            time_t atTargetT    = chrono::system_clock::to_time_t(atWallTarget);
-            if (isTargetTomorrow(atTargetT))
-                cout << t(Str::TOMORROW_SUFFIX);
+// Register aller laufenden Timer im benannten Shared Memory (Local\TeefaxTimers).
+// Jeder Timer belegt einen Platz und ist dessen einziger Schreiber; jeder Platz
+// ist per Seqlock geschützt: ungerade Sequenz = Schreiben im Gange. Leser
+// kopieren und prüfen die Sequenz danach erneut – sie blockieren den Timer nie,
+// der Timer wartet nie auf sie. Abgestürzte Timer erkennt der Leser an PID und
+// Startzeit des Prozesses (eine wiederverwendete PID gehört einem anderen Prozess).
+class TimerRegistry {
+public:
+    static constexpr uint32_t MAGIC = 0x32524654; // "TFR2": Format-Version steckt im Magic
+    static constexpr int      SLOTS = 64;
+
+    struct Slot {
+        atomic<uint32_t> seq;
+        atomic<uint32_t> pid;       // 0 = frei
+        atomic<uint64_t> startTime; // Erstellungszeit des Besitzers (FILETIME)
+        TimerStatus      status;
+    };
+
+    static TimerRegistry& instance() { static TimerRegistry r; return r; }
+
+    // Abbildung öffnen bzw. anlegen; false, wenn kein (passendes) Register.
+    bool open() {
+        if (view) return true;
+        if (failed) return false;
+        hMap = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
+                                  sizeof(Layout), L"Local\\TeefaxTimers");
+        if (hMap) view = static_cast<Layout*>(MapViewOfFile(hMap, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(Layout)));
+        if (!view) { failed = true; return false; }
+        uint32_t expected = 0; // neu angelegt: Speicher ist genullt
+        if (!view->magic.compare_exchange_strong(expected, MAGIC) && expected != MAGIC) {
+            failed = true; // anderes Format (ältere/neuere Version läuft)
+            return false;
         }
+        return true;
+    }
 
-    } else if (cfg.useDailyTimes) {
-        cout << t(Str::TIMER_DAILY);
+    // Platz für diesen Prozess belegen: freien Platz oder den eines beendeten Prozesses.
+    // Ein übernommener Platz trägt noch Zustand und Sequenz des Vorbesitzers (der evtl.
+    // mitten im Schreiben starb); beides wird sofort durch einen leeren Zustand ersetzt.
+    void join() {
+        if (mine || !open()) return;
+        const uint32_t self      = GetCurrentProcessId();
+        const uint64_t selfStart = processStartTime(GetCurrentProcess());
+        for (int pass = 0; pass < 2 && !mine; ++pass) {
+            for (Slot& slot : view->slots) {
+                uint32_t owner = slot.pid.load(memory_order_acquire);
+                if (pass == 0 ? owner != 0
+                              : (owner == 0 || processAlive(owner, slot.startTime.load(memory_order_acquire))))
+                    continue;
+                if (slot.pid.compare_exchange_strong(owner, self, memory_order_acq_rel)) {
+                    mine = &slot;
+                    break;
+                }
+            }
+        }
+        if (!mine) return;
+        uint32_t s = mine->seq.load(memory_order_relaxed) | 1; // ungerade: Schreiben im Gange
+        mine->seq.store(s, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        mine->startTime.store(selfStart, memory_order_relaxed);
+        mine->status = TimerStatus{};                   // state = Starting
+        mine->seq.store(s + 1, memory_order_release);   // wieder gerade
+    }
 
-    } else if (cfg.useEvery) {
-        string daysStr = formatEveryDays(cfg.everySpec);
-        snprintf(buf, sizeof(buf), t(Str::TIMER_EVERY),
-                 daysStr.c_str(), cfg.everySpec.hour, cfg.everySpec.minute, cfg.everySpec.second);
-        cout << buf;
+    // Nur vom Timer-Thread; ohne Platz (Register voll/fehlt) wirkungslos.
+    void publish(const TimerStatus& st) {
+        if (!mine) return;
+        uint32_t s = mine->seq.load(memory_order_relaxed);
+        mine->seq.store(s + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        memcpy(&mine->status, &st, sizeof(st));
+        mine->seq.store(s + 2, memory_order_release);
+    }
 
-    } else {
-        // Countdown: Dauer anzeigen.
-        // Zielzeit (HH:MM:SS) nur bei < 24 Stunden: bei längeren Timern ohne Aussagekraft;
-        // außerdem wäre localtime_s für weit-zukünftige time_t-Werte nicht zuverlässig.
-        string timerStr = formatVerbleibend(cfg.ms / 1000);
-        snprintf(buf, sizeof(buf), t(Str::TIMER_COUNTER), timerStr.c_str());
-        cout << buf;
+    // Erst als Starting markieren (Leser blenden den Platz sofort aus), dann freigeben.
+    void leave() {
+        if (!mine) return;
+        publish(TimerStatus{});
+        mine->pid.store(0, memory_order_release);
+        mine = nullptr;
+    }
 
-        if (cfg.ms < 86400000LL) {
-            auto   targetWall = chrono::system_clock::now() + chrono::milliseconds(cfg.ms);
-            time_t targetT    = chrono::system_clock::to_time_t(targetWall);
-            tm     targetTm{};
-            if (localtime_s(&targetTm, &targetT) == 0) {
-                char tbuf[64];
-                snprintf(tbuf, sizeof(tbuf), t(Str::TIMER_TARGET),
-                         targetTm.tm_hour, targetTm.tm_min, targetTm.tm_sec);
-                cout << tbuf;
-            }
+    // Konsistente Kopie eines belegten Platzes; false bei freiem Platz, beendetem
+    // Besitzer oder (nach einigen Versuchen) dauerndem Schreiben.
+    bool read(int index, uint32_t& pid, TimerStatus& out) {
+        if (!open()) return false;
+        Slot& slot = view->slots[index];
+        for (int attempt = 0; attempt < 100; ++attempt) {
+            uint32_t s1 = slot.seq.load(memory_order_acquire);
+            pid = slot.pid.load(memory_order_acquire);
+            if (pid == 0) return false;
+            if (s1 & 1) { YieldProcessor(); continue; }
+            memcpy(&out, &slot.status, sizeof(out));
+            atomic_thread_fence(memory_order_acquire);
+            if (slot.seq.load(memory_order_relaxed) != s1) continue;
+            return out.state != TimerState::Starting &&
+                   processAlive(pid, slot.startTime.load(memory_order_acquire));
         }
+        return false;
     }
 
-    if (cfg.asyncSound)
-        cout << t(Str::ASYNC_SUFFIX);
-    if (!cfg.focusWindow.empty()) {
-        snprintf(buf, sizeof(buf), t(Str::FOCUS_TARGET),
-                 toConsole(toWideArgv(cfg.focusWindow)).c_str());
-        cout << buf;
+    // Wie read(), aber über die PID des Timers (--attach <id>).
+    bool readByPid(uint32_t pid, TimerStatus& out) {
+        if (!open()) return false;
+        uint32_t owner = 0;
+        for (int i = 0; i < SLOTS; ++i)
+            if (view->slots[i].pid.load(memory_order_relaxed) == pid && read(i, owner, out) && owner == pid)
+                return true;
+        return false;
+    }
+
+private:
+    struct Layout {
+        atomic<uint32_t> magic;
+        Slot             slots[SLOTS];
+    };
+
+    TimerRegistry() = default;
+
+    // Erstellungszeit eines Prozesses (FILETIME als Zahl); 0, wenn nicht lesbar.
+    static uint64_t processStartTime(HANDLE h) {
+        FILETIME created{}, exited{}, kernel{}, user{};
+        if (!GetProcessTimes(h, &created, &exited, &kernel, &user)) return 0;
+        return (static_cast<uint64_t>(created.dwHighDateTime) << 32) | created.dwLowDateTime;
     }
-    if (!cfg.openFile.empty()) {
-        snprintf(buf, sizeof(buf), t(Str::OPEN_TARGET),
-                 toConsole(toWideArgv(cfg.openFile)).c_str());
-        cout << buf;
+
+    // Läuft der Prozess 'pid' noch, und ist es derselbe, der den Platz belegt hat?
+    static bool processAlive(uint32_t pid, uint64_t startTime) {
+        HANDLE h = OpenProcess(SYNCHRONIZE | PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+        if (!h) return GetLastError() == ERROR_ACCESS_DENIED; // fremde Sitzung: lebt
+        bool alive = WaitForSingleObject(h, 0) == WAIT_TIMEOUT;
+        if (alive && startTime != 0) {
+            uint64_t actual = processStartTime(h);
+            alive = actual == 0 || actual == startTime; // PID inzwischen neu vergeben?
+        }
+        CloseHandle(h);
+        return alive;
     }
-    cout << "\n";
+
+    HANDLE  hMap   = nullptr;
+    Layout* view   = nullptr;
+    Slot*   mine   = nullptr;
+    bool    failed = false;
+};
+
+// Gibt den Registerplatz beim Verlassen von runTimerLoop() frei (auch bei Fehlern).
+struct TimerRegistryGuard {
+    TimerRegistryGuard()  { TimerRegistry::instance().join(); }
+    ~TimerRegistryGuard() { TimerRegistry::instance().leave(); }
+};
+
+static int64_t wallNowMs() {
+    return chrono::duration_cast<chrono::milliseconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
 }
 
-// ═══════════════════════════════════════════════════════════════════════════
-// ── Vorab-Prüfungen ────────────────────────────────────────────────────────
-// ═══════════════════════════════════════════════════════════════════════════
+// Restzeit eines veröffentlichten Zustands aus Sicht des Lesers.
+static int64_t registryRemainingMs(const TimerStatus& st) {
+    if (st.state == TimerState::Paused) return st.remainingMs;
+    if (st.state == TimerState::Alarm)  return 0;
+    return max<int64_t>(0, st.deadlineWallMs - wallNowMs());
+}
 
-// Prüft vor dem Timer-Start, ob Fenster und Datei bereits erreichbar sind.
-// Warnungen erscheinen einmalig nach der Startmeldung.
-static void doPreChecks(const TimerConfig& cfg) {
-    if (!cfg.focusWindow.empty() && !findWindowByTitle(cfg.focusWindow)) {
-        char buf[256];
-        snprintf(buf, sizeof(buf), t(Str::WINDOW_NOT_FOUND_WARN),
-                 toConsole(toWideArgv(cfg.focusWindow)).c_str());
-        cout << buf << "\n" << flush;
+// --status: alle laufenden Timer auflisten. Liest nur das Shared Memory.
+static int printTimerStatus() {
+    auto&       registry = TimerRegistry::instance();
+    bool        any      = false;
+    char        line[512];
+    uint32_t    pid = 0;
+    TimerStatus st;
+    for (int i = 0; i < TimerRegistry::SLOTS; ++i) {
+        if (!registry.read(i, pid, st)) continue;
+        if (!any) { cout << t(Str::STATUS_HEADER) << "\n"; any = true; }
+        char remaining[96];
+        formatVerbleibendTo(remaining, sizeof(remaining), (registryRemainingMs(st) + 999) / 1000);
+        const char* state = st.state == TimerState::Paused ? t(Str::STATUS_STATE_PAUSED)
+                          : st.state == TimerState::Alarm  ? t(Str::STATUS_STATE_ALARM)
+                                                           : t(Str::STATUS_STATE_RUNNING);
+        char loops[32] = "-";
+        if (st.loop) snprintf(loops, sizeof(loops), "%lld", static_cast<long long>(st.loopCount));
+        snprintf(line, sizeof(line), "%-8u %-10s %-12s %-10s %-9s %s", pid, st.mode, state, remaining,
+                 loops, toConsole(toWide(st.label)).c_str());
+        cout << line << "\n";
     }
+    if (!any) cout << t(Str::STATUS_NONE) << "\n";
+    return 0;
+}
 
-    if (!cfg.openFile.empty()) {
-        bool isUrl = cfg.openFile.rfind("http://", 0) == 0 ||
-                     cfg.openFile.rfind("https://", 0) == 0;
-        if (!isUrl) {
-            try {
-                if (!fs::exists(fs::path(cfg.openFile))) {
-                    char buf[256];
-                    snprintf(buf, sizeof(buf), t(Str::FILE_NOT_FOUND_WARN),
-                             toConsole(toWideArgv(cfg.openFile)).c_str());
-                    cout << buf << "\n" << flush;
-                }
-            } catch (const fs::filesystem_error&) {
-                // Pfad ungültig; openFileAfterTimer() gibt beim Ablauf eine präzise Meldung.
-            }
+// --attach <id>: Statuszeile eines anderen Timers live anzeigen, bis er endet
+// oder Esc/Q gedrückt wird. Zeichnet zehnmal pro Sekunde aus dem Shared Memory.
+static int attachToTimer(const string& idArg) {
+    char buf[256];
+    uint32_t    pid = static_cast<uint32_t>(max(0, safeStoi(idArg, 0)));
+    TimerStatus st;
+    if (pid == 0 || !TimerRegistry::instance().readByPid(pid, st)) {
+        snprintf(buf, sizeof(buf), t(Str::ATTACH_NOT_FOUND), idArg.c_str());
+        cout << buf << "\n";
+        return 1;
+    }
+    auto& input = ConsoleInput::instance();
+    input.start();
+    for (;;) {
+        if (!TimerRegistry::instance().readByPid(pid, st)) break;
+        int64_t remainingMs = registryRemainingMs(st);
+        char remaining[160];
+        int  n = formatVerbleibendTo(remaining, sizeof(remaining), (remainingMs + 999) / 1000);
+        if (st.state != TimerState::Running)
+            snprintf(remaining + n, sizeof(remaining) - n, " %s",
+                     st.state == TimerState::Paused ? t(Str::STOPWATCH_PAUSED) : t(Str::STATUS_STATE_ALARM));
+        char prefix[256];
+        int  prefixLen = buildBarPrefix(prefix, sizeof(prefix), st.loop != 0, st.loopCount, remaining, 0);
+        int  width     = calcEffectiveBarWidth(displayWidth(prefix, static_cast<size_t>(prefixLen)),
+                                               StatusRenderer::BAR_WIDTH);
+        double fraction = st.totalMs > 0 ? 1.0 - static_cast<double>(remainingMs) / st.totalMs : 1.0;
+        int    filled   = static_cast<int>(min(max(fraction, 0.0), 1.0) * width);
+        char   line[LineRenderer::MAX_LINE];
+        g_statusLine.draw(line, composeBarLine(line, prefix, prefixLen, filled, width, false));
+        int key = 0;
+        if (input.waitKey(key, 100) && (key == 27 || key == 'q' || key == 'Q')) {
+            cout << "\n" << flush;
+            return 0;
         }
     }
+    snprintf(buf, sizeof(buf), t(Str::ATTACH_ENDED), pid);
+    cout << "\n" << buf << "\n" << flush;
+    return 0;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
-// ── Interaktive Modi ───────────────────────────────────────────────────────
+// ── Steuerkanal (--control) ────────────────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════
 
-static int runLiveClockMode() {
-    system("cls");
-    while (true) {
-        auto   now   = chrono::system_clock::now();
-        time_t tnow  = chrono::system_clock::to_time_t(now);
-        tm     local{};
-        localtime_s(&local, &tnow);
+constexpr long long EXTEND_MS = 60 * 1000; // + während des Countdowns
 
-        char timebuf[32];
-        strftime(timebuf, sizeof(timebuf), "%Y-%m-%d %H:%M:%S", &local);
-        cout << "\r" << timebuf << flush;
+// Befehle an den laufenden Countdown, von der Tastatur (timerKeyFor) oder über
+// den Steuerkanal eines anderen Prozesses.
+enum class TimerCmd : uint8_t { None, TogglePause, Pause, Resume, Adjust, TargetIn, TargetAt, Cancel };
 
-        char titlebuf[48];
-        snprintf(titlebuf, sizeof(titlebuf), "Teefax - %s", timebuf);
-        SetConsoleTitleA(titlebuf);
+struct TimerCommand {
+    TimerCmd  kind   = TimerCmd::None;
+    long long ms     = 0; // Adjust: Differenz (auch negativ), TargetIn: neue Restzeit
+    int       hour   = 0; // TargetAt: nächstes Vorkommen dieser Uhrzeit
+    int       minute = 0;
+    int       second = 0;
+};
 
-        auto next = chrono::time_point_cast<chrono::seconds>(now) + chrono::seconds(1);
-        this_thread::sleep_until(next);
+// key: UTF-16-Wert aus ConsoleInput; Nicht-ASCII-Zeichen lösen nie einen Befehl aus.
+static TimerCommand timerKeyFor(int key) {
+    TimerCommand c;
+    if (key <= 0 || key >= 0x80) return c;
+    if (key == ' ' || key == 'p' || key == 'P')     c.kind = TimerCmd::TogglePause;
+    else if (key == '+')                            { c.kind = TimerCmd::Adjust; c.ms = EXTEND_MS; }
+    else if (key == 27 || key == 'q' || key == 'Q') c.kind = TimerCmd::Cancel;
+    return c;
+}
+
+// Drahtformat (eine Nachricht je Verbindung, ASCII): "pause", "resume", "cancel",
+// "adjust <ms>", "target-in <ms>", "target-at <h>:<m>:<s>". Die Zeitangaben
+// wertet schon der Client (--control) aus, der Timer liest nur noch Zahlen.
+static bool parseControlMessage(const char* msg, TimerCommand& out) {
+    char      word[16] = {};
+    long long value    = 0;
+    int       h = 0, m = 0, sec = 0;
+    if (sscanf(msg, "%15s", word) != 1) return false;
+    out = TimerCommand{};
+    if      (strcmp(word, "pause")  == 0) out.kind = TimerCmd::Pause;
+    else if (strcmp(word, "resume") == 0) out.kind = TimerCmd::Resume;
+    else if (strcmp(word, "cancel") == 0) out.kind = TimerCmd::Cancel;
+    else if (strcmp(word, "adjust") == 0 && sscanf(msg, "%*s %lld", &value) == 1) {
+        out.kind = TimerCmd::Adjust;
+        out.ms   = value;
+    } else if (strcmp(word, "target-in") == 0 && sscanf(msg, "%*s %lld", &value) == 1 && value >= 0) {
+        out.kind = TimerCmd::TargetIn;
+        out.ms   = value;
+    } else if (strcmp(word, "target-at") == 0 && sscanf(msg, "%*s %d:%d:%d", &h, &m, &sec) == 3 &&
+               h >= 0 && h < 24 && m >= 0 && m < 60 && sec >= 0 && sec < 60) {
+        out.kind   = TimerCmd::TargetAt;
+        out.hour   = h;
+        out.minute = m;
+        out.second = sec;
+    } else {
+        return false;
     }
-    return 0; // via Strg+C
+    return true;
 }
 
-static int runStopwatchMode() {
-    char buf[256];
-    snprintf(buf, sizeof(buf), t(Str::STARTED), PRG_VERSION);
-    cout << buf << " (" << t(Str::STOPWATCH_LABEL) << ")\n";
-    cout << t(Str::STOPWATCH_HINT) << "\n";
+// Name der Steuer-Pipe eines Timers; die ID ist wie bei --status die Prozess-ID.
+static wstring controlPipeName(unsigned long pid) {
+    return L"\\\\.\\pipe\\teefax-" + to_wstring(pid);
+}
 
-    auto  start        = chrono::steady_clock::now();
-    bool  isPaused     = false;
-    chrono::steady_clock::time_point pauseStart;
-    long long frozenMs     = 0;
-    long long lastTitleSec = -1;
+// Pipe-Server des laufenden Timers in einem eigenen Thread niedriger Priorität.
+// Gültige Befehle landen in einem SPSC-Ring und setzen event(); die Zeitschleife
+// wartet ohnehin auf ihre Frist und Tasten und nimmt dieses Ereignis einfach mit
+// in die Wartemenge auf – Befehle wirken sofort, ohne Abfrage.
+class ControlChannel {
+public:
+    static ControlChannel& instance() { static ControlChannel c; return c; }
+
+    // Startet den Server (einmalig); ohne Pipe bleibt event() nullptr.
+    void start() {
+        if (cmdEvent) return;
+        pipeName = controlPipeName(GetCurrentProcessId());
+        HANDLE first = createPipe();
+        if (first == INVALID_HANDLE_VALUE) return;
+        cmdEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        thread([this, first]{ threadMain(first); }).detach(); // bedient bis Programmende
+    }
 
-    while (true) {
-        if (_kbhit()) {
-            int key = _getch();
-            if (key == ' ' || key == 'p' || key == 'P') {
-                if (!isPaused) {
-                    isPaused   = true;
-                    pauseStart = chrono::steady_clock::now();
-                    frozenMs   = chrono::duration_cast<chrono::milliseconds>(
-                                   pauseStart - start).count();
-                } else {
-                    start    += chrono::steady_clock::now() - pauseStart;
-                    isPaused  = false;
-                }
-            } else if (key == 'r' || key == 'R') {
-                auto now   = chrono::steady_clock::now();
-                start      = now;
-                pauseStart = now;
-                isPaused   = true;
-                frozenMs   = 0;
-                lastTitleSec = -1;
-            }
+    HANDLE event() const { return cmdEvent; }
+
+    // Was der Kanal gerade annimmt: im Countdown alles, während des Alarms nur
+    // cancel, bei Aktionen und Benachrichtigung nichts. Abgelehnte Befehle erhalten
+    // "busy", statt im Ring auf den nächsten Durchlauf zu warten.
+    enum class Accept { All, CancelOnly, None };
+    void setAccept(Accept a) { accept.store(a, memory_order_release); }
+
+    // Liegengebliebene Befehle verwerfen; nur von der Zeitschleife.
+    void clear() { cmdHead.store(cmdTail.load(memory_order_acquire), memory_order_release); }
+
+    // Nächster Befehl; nur von der Zeitschleife.
+    bool pop(TimerCommand& out) {
+        unsigned head = cmdHead.load(memory_order_relaxed);
+        if (head == cmdTail.load(memory_order_acquire)) return false;
+        out = cmds[head % CAPACITY];
+        cmdHead.store(head + 1, memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr unsigned CAPACITY = 16;
+
+    ControlChannel() = default;
+
+    // Ein Client, der verbindet und dann schweigt, blockiert die einzige Instanz
+    // höchstens so lange.
+    static constexpr DWORD IO_TIMEOUT_MS = 1000;
+
+    // Genau eine Instanz, die nach jedem Client wiederverwendet wird. FIRST_PIPE_INSTANCE:
+    // Hat ein anderer Prozess den Namen schon belegt, schlägt das fehl, statt dass
+    // Befehle an ihn gehen; der Timer läuft dann ohne Steuerkanal. Öffnen darf die
+    // Pipe nur der eigene Benutzer (die Standard-DACL ließe weitere Konten zu).
+    HANDLE createPipe() {
+        HANDLE token = nullptr;
+        if (!OpenProcessToken(GetCurrentProcess(), TOKEN_QUERY, &token)) return INVALID_HANDLE_VALUE;
+        DWORD size = 0;
+        GetTokenInformation(token, TokenUser, nullptr, 0, &size);
+        vector<uint8_t> user(size);
+        bool ok = size > 0 && GetTokenInformation(token, TokenUser, user.data(), size, &size);
+        CloseHandle(token);
+        if (!ok) return INVALID_HANDLE_VALUE;
+
+        PSID            sid = reinterpret_cast<TOKEN_USER*>(user.data())->User.Sid;
+        vector<uint8_t> aclBuf(sizeof(ACL) + sizeof(ACCESS_ALLOWED_ACE) + GetLengthSid(sid));
+        PACL            acl = reinterpret_cast<PACL>(aclBuf.data());
+        SECURITY_DESCRIPTOR sd{};
+        if (!InitializeAcl(acl, static_cast<DWORD>(aclBuf.size()), ACL_REVISION) ||
+            !AddAccessAllowedAce(acl, ACL_REVISION, GENERIC_READ | GENERIC_WRITE, sid) ||
+            !InitializeSecurityDescriptor(&sd, SECURITY_DESCRIPTOR_REVISION) ||
+            !SetSecurityDescriptorDacl(&sd, TRUE, acl, FALSE))
+            return INVALID_HANDLE_VALUE;
+        SECURITY_ATTRIBUTES sa{ sizeof(sa), &sd, FALSE };
+
+        return CreateNamedPipeW(pipeName.c_str(),
+                                PIPE_ACCESS_DUPLEX | FILE_FLAG_FIRST_PIPE_INSTANCE | FILE_FLAG_OVERLAPPED,
+                                PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT |
+                                PIPE_REJECT_REMOTE_CLIENTS,
+                                1, 256, 256, 0, &sa);
+    }
+
+    // Überlappten Lese-/Schreibvorgang abschließen ('started': Rückgabe von
+    // ReadFile/WriteFile). Nach IO_TIMEOUT_MS wird er abgebrochen (false).
+    static bool finishIo(HANDLE pipe, OVERLAPPED& ov, BOOL started, DWORD& n) {
+        n = 0;
+        if (!started && GetLastError() != ERROR_IO_PENDING) return false;
+        if (WaitForSingleObject(ov.hEvent, IO_TIMEOUT_MS) != WAIT_OBJECT_0) {
+            CancelIoEx(pipe, &ov);
+            GetOverlappedResult(pipe, &ov, &n, TRUE); // Abbruch abwarten, ov wird wiederverwendet
+            return false;
         }
+        return GetOverlappedResult(pipe, &ov, &n, FALSE) != FALSE;
+    }
+
+    bool accepts(const TimerCommand& c) const {
+        Accept a = accept.load(memory_order_acquire);
+        return a == Accept::All || (a == Accept::CancelOnly && c.kind == TimerCmd::Cancel);
+    }
 
-        long long elapsedMs = isPaused
-                                  ? frozenMs
-                                  : chrono::duration_cast<chrono::milliseconds>(
-                                        chrono::steady_clock::now() - start).count();
-        long long elapsedSec = elapsedMs / 1000;
-        int       cs         = static_cast<int>((elapsedMs % 1000) / 10);
-        string    secStr     = formatVerbleibend(elapsedSec);
+    bool push(const TimerCommand& c) {
+        unsigned tail = cmdTail.load(memory_order_relaxed);
+        if (tail - cmdHead.load(memory_order_acquire) >= CAPACITY) return false;
+        cmds[tail % CAPACITY] = c;
+        cmdTail.store(tail + 1, memory_order_release);
+        SetEvent(cmdEvent);
+        return true;
+    }
 
-        if (elapsedSec != lastTitleSec) {
-            lastTitleSec = elapsedSec;
-            wstring titleW = L"Teefax - " + toWide(t(Str::STOPWATCH_LABEL)) + L" - "
-                             + wstring(secStr.begin(), secStr.end());
-            SetConsoleTitleW(titleW.c_str());
+    void threadMain(HANDLE pipe) {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+        OVERLAPPED ov{};
+        ov.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!ov.hEvent) return;
+        for (;;) {
+            // Auf den nächsten Client warten (ohne Zeitlimit: der Thread schläft im Kern)
+            DWORD n  = 0;
+            BOOL  ok = ConnectNamedPipe(pipe, &ov);
+            if (!ok && GetLastError() == ERROR_IO_PENDING) ok = GetOverlappedResult(pipe, &ov, &n, TRUE);
+            else if (!ok) ok = GetLastError() == ERROR_PIPE_CONNECTED;
+            if (ok) serve(pipe, ov);
+            DisconnectNamedPipe(pipe);
         }
+    }
+
+    // Einen Befehl lesen und beantworten; jeder Schritt mit Zeitlimit.
+    void serve(HANDLE pipe, OVERLAPPED& ov) {
+        char  msg[256];
+        DWORD n = 0;
+        if (!finishIo(pipe, ov, ReadFile(pipe, msg, sizeof(msg) - 1, nullptr, &ov), n)) return;
+        msg[n] = '\0';
+        TimerCommand c;
+        const char* reply = !parseControlMessage(msg, c) ? "error"
+                          : accepts(c) && push(c)        ? "ok"
+                                                         : "busy";
+        if (!finishIo(pipe, ov, WriteFile(pipe, reply, static_cast<DWORD>(strlen(reply)), nullptr, &ov), n))
+            return;
+        // Statt FlushFileBuffers (wartet unbegrenzt auf den Client): bis zum Zeitlimit
+        // warten, dass der Client die Antwort gelesen und die Pipe geschlossen hat.
+        char rest;
+        finishIo(pipe, ov, ReadFile(pipe, &rest, 1, nullptr, &ov), n);
+    }
 
-        char timebuf[64];
-        snprintf(timebuf, sizeof(timebuf), "%s.%02d", secStr.c_str(), cs);
-        char dispbuf[128];
-        snprintf(dispbuf, sizeof(dispbuf), t(Str::ELAPSED), timebuf);
+    wstring          pipeName;
+    HANDLE           cmdEvent = nullptr;
+    TimerCommand     cmds[CAPACITY]{};
+    atomic<unsigned> cmdHead{0}, cmdTail{0};
+    atomic<Accept>   accept{Accept::None};
+};
 
-        char linebuf[256];
-        if (isPaused)
-            snprintf(linebuf, sizeof(linebuf), "%s %s", dispbuf, t(Str::STOPWATCH_PAUSED));
-        else
-            snprintf(linebuf, sizeof(linebuf), "%s", dispbuf);
-        cout << "\r" << linebuf << "            " << flush;
+// --control <id> <befehl> [wert]: Befehl an einen laufenden Timer senden.
+// pause, resume, cancel; add/sub <Dauer>; target <HH:MM[:SS]> oder target <Dauer>.
+static int sendControlCommand(const vector<string>& args, int i) {
+    const int n = static_cast<int>(args.size());
+    char buf[256];
+    if (i + 2 >= n) { cout << t(Str::CONTROL_USAGE) << "\n"; return 1; }
+    const string& idArg = args[i + 1];
+    const string& cmd   = args[i + 2];
+    const string  value = i + 3 < n ? args[i + 3] : "";
+
+    // Auf Client-Seite in das Drahtformat übersetzen (Zeitangaben wie auf der Kommandozeile)
+    char msg[64];
+    int  h = 0, m = 0, sec = 0;
+    if (cmd == "pause" || cmd == "resume" || cmd == "cancel") {
+        snprintf(msg, sizeof(msg), "%s", cmd.c_str());
+    } else if ((cmd == "add" || cmd == "sub") && isValidTimeExpression(value)) {
+        long long ms = parseTime(value);
+        snprintf(msg, sizeof(msg), "adjust %lld", cmd == "add" ? ms : -ms);
+    } else if (cmd == "target" && sscanf(value.c_str(), "%d:%d:%d", &h, &m, &sec) >= 2) {
+        if (count(value.begin(), value.end(), ':') == 1) sec = 0;
+        snprintf(msg, sizeof(msg), "target-at %d:%d:%d", h, m, sec);
+    } else if (cmd == "target" && isValidTimeExpression(value)) {
+        snprintf(msg, sizeof(msg), "target-in %lld", parseTime(value));
+    } else {
+        cout << t(Str::CONTROL_USAGE) << "\n";
+        return 1;
+    }
 
-        if (isPaused)
-            this_thread::sleep_for(chrono::milliseconds(10));
-        else {
-            // Nächste 10ms-Grenze relativ zum Startpunkt – keine Drift
-            auto nextTick = start + chrono::milliseconds(((elapsedMs / 10) + 1) * 10);
-            this_thread::sleep_until(nextTick);
+    unsigned long pid  = static_cast<unsigned long>(max(0, safeStoi(idArg, 0)));
+    wstring       name = controlPipeName(pid);
+    HANDLE        pipe = INVALID_HANDLE_VALUE;
+    for (int attempt = 0; pid != 0 && attempt < 2; ++attempt) {
+        pipe = CreateFileW(name.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+        if (pipe != INVALID_HANDLE_VALUE || GetLastError() != ERROR_PIPE_BUSY) break;
+        WaitNamedPipeW(name.c_str(), 2000); // anderer Client wird gerade bedient
+    }
+    if (pipe == INVALID_HANDLE_VALUE) {
+        snprintf(buf, sizeof(buf), t(Str::ATTACH_NOT_FOUND), idArg.c_str());
+        cout << buf << "\n";
+        return 1;
+    }
+    DWORD mode = PIPE_READMODE_MESSAGE;
+    SetNamedPipeHandleState(pipe, &mode, nullptr, nullptr);
+    char  reply[16] = {};
+    DWORD written = 0, got = 0;
+    bool  ok = WriteFile(pipe, msg, static_cast<DWORD>(strlen(msg)), &written, nullptr) &&
+               ReadFile(pipe, reply, sizeof(reply) - 1, &got, nullptr) && strcmp(reply, "ok") == 0;
+    CloseHandle(pipe);
+    snprintf(buf, sizeof(buf), t(ok ? Str::CONTROL_SENT : Str::CONTROL_FAILED), cmd.c_str(), idArg.c_str());
+    cout << buf << "\n";
+    return ok ? 0 : 1;
+}
+
+// --status / --attach <id> / --control <id> ...: wie --macro vor dem Parser.
+// Rückgabe: -1 = keiner dieser Befehle.
+static int handleRegistryCommands(const vector<string>& args) {
+    const int n = static_cast<int>(args.size());
+    for (int i = 0; i < n; ++i) {
+        if (args[i] == "--status")  return printTimerStatus();
+        if (args[i] == "--control") return sendControlCommand(args, i);
+        if (args[i] == "--attach") {
+            if (i + 1 >= n) { cout << t(Str::ATTACH_MISSING_ID) << "\n"; return 1; }
+            return attachToTimer(args[i + 1]);
         }
     }
-    return 0; // via Strg+C
+    return -1;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
-// ── Fortschrittsbalken ─────────────────────────────────────────────────────
+// ── Alarm und Aktionen nach Ablauf ─────────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════
 
-// Berechnet die verfügbare Balkenbreite anhand der Konsolenbreite.
-// Verhindert Zeilenumbrüche in schmalen Fenstern; gibt 0 zurück wenn kein Platz.
-static int calcEffectiveBarWidth(int prefixLen, int maxBarWidth) {
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)) {
-        int w = (csbi.srWindow.Right - csbi.srWindow.Left + 1) - prefixLen - 13;
-        if (w < 0) return 0;
-        return (w > maxBarWidth) ? maxBarWidth : w;
-    }
-    return maxBarWidth;
+// Ausgang des Alarms: normal ausgeklungen, per Taste beendet oder geschlummert.
+enum class AlarmOutcome { Done, Dismissed, Snoozed };
+
+// Tasten während des Alarms: S schlummert, Esc oder Q beendet, andere zählen nicht.
+static AlarmOutcome alarmKeyOutcome(int key) { // key wie bei timerKeyFor: UTF-16, nur ASCII
+    if (key <= 0 || key >= 0x80)               return AlarmOutcome::Done;
+    if (key == 's' || key == 'S')              return AlarmOutcome::Snoozed;
+    if (key == 27 || key == 'q' || key == 'Q') return AlarmOutcome::Dismissed;
+    return AlarmOutcome::Done;
 }
 
-// Baut den Präfix-Text auf: ggf. Schleifenzähler + verbleibende Zeit + "morgen"-Suffix.
-static string buildBarPrefix(bool loop, long long loopCount,
-                             const string& verbleibendStr, time_t wallTargetT) {
-    char   buf[128];
-    string prefix;
-    if (loop) {
-        snprintf(buf, sizeof(buf), t(Str::LOOP_PREFIX), loopCount);
-        prefix += buf;
-    }
-    snprintf(buf, sizeof(buf), t(Str::REMAINING), verbleibendStr.c_str());
-    prefix += buf;
-    if (wallTargetT != 0 && isTargetTomorrow(wallTargetT))
-        prefix += t(Str::TOMORROW_SUFFIX);
-    return prefix;
+// Steuerbefehle während des Alarms: cancel beendet ihn wie Esc/Q. Andere Befehle
+// nimmt der Steuerkanal in dieser Phase gar nicht erst an.
+static AlarmOutcome alarmControlOutcome() {
+    TimerCommand cmd;
+    while (ControlChannel::instance().pop(cmd))
+        if (cmd.kind == TimerCmd::Cancel) return AlarmOutcome::Dismissed;
+    return AlarmOutcome::Done;
 }
 
-// Zeichnet einen Fortschrittsbalken. filled == total ergibt einen vollen Balken.
-static void renderBar(const string& prefix, int filled, int total) {
-    cout << "\r" << prefix;
-    if (total > 0) {
-        cout << " [";
-        for (int i = 0; i < total; ++i) cout << (i < filled ? '#' : '-');
-        cout << "]";
+// Wartet bis zu timeoutMs auf eine Alarmtaste oder cancel über den Steuerkanal;
+// andere Tasten werden verworfen. Ohne beides einfach Schlaf.
+static AlarmOutcome waitAlarmKey(long long timeoutMs) {
+    auto&        input   = ConsoleInput::instance();
+    const HANDLE control = ControlChannel::instance().event();
+    if (!input.available() && !control) {
+        this_thread::sleep_for(chrono::milliseconds(timeoutMs));
+        return AlarmOutcome::Done;
+    }
+    auto until = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+    for (;;) {
+        auto left = chrono::duration_cast<chrono::milliseconds>(until - chrono::steady_clock::now()).count();
+        if (left <= 0) return AlarmOutcome::Done;
+        int          key = 0;
+        AlarmOutcome o   = AlarmOutcome::Done;
+        if (!input.available())
+            WaitForSingleObject(control, static_cast<DWORD>(left));
+        else if (input.waitKey(key, static_cast<DWORD>(left), control))
+            o = alarmKeyOutcome(key);
+        if (o == AlarmOutcome::Done) o = alarmControlOutcome();
+        if (o != AlarmOutcome::Done) return o;
     }
-    cout << "        " << flush;
 }
 
-// ═══════════════════════════════════════════════════════════════════════════
-// ── Alarm und Aktionen nach Ablauf ─────────────────────────────────────────
-// ═══════════════════════════════════════════════════════════════════════════
+// Wie mixer.wait(voice), bricht aber bei S, Esc/Q oder cancel ab und stoppt die Stimme.
+// Wartet gemeinsam auf Tastendruck, Steuerbefehl und Stimmenende, ohne Abfrageschleife.
+static AlarmOutcome waitAlarmVoice(int voice) {
+    auto&        mixer   = AudioMixer::instance();
+    auto&        input   = ConsoleInput::instance();
+    const HANDLE control = ControlChannel::instance().event();
+    if (!input.available() && !control) {
+        mixer.wait(voice);
+        return AlarmOutcome::Done;
+    }
+    while (!mixer.finishedVoice(voice)) {
+        int          key = 0;
+        AlarmOutcome o   = AlarmOutcome::Done;
+        if (!input.available()) {
+            HANDLE handles[2] = { mixer.finishedSignal(), control };
+            WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+        } else if (input.waitKey(key, INFINITE, mixer.finishedSignal(), control)) {
+            o = alarmKeyOutcome(key);
+        }
+        if (o == AlarmOutcome::Done) o = alarmControlOutcome();
+        if (o != AlarmOutcome::Done) { mixer.stop(voice); return o; }
+    }
+    return AlarmOutcome::Done;
+}
 
 // Spielt den Alarmton entsprechend der Konfiguration ab (mit Wiederholungen).
-static void playAlarmSound(const TimerConfig& cfg) {
+// Während des Alarms schlummert S, Esc oder Q beendet die restlichen Wiederholungen.
+static AlarmOutcome playAlarmSound(const TimerConfig& cfg) {
     for (long long r = 0; cfg.alarmRepeat == 0 || r < cfg.alarmRepeat; ++r) {
         if (!cfg.soundFile.empty()) {
             try {
                 fs::path p(cfg.soundFile);
                 if (!fs::exists(p) || !fs::is_regular_file(p)) {
+                    StatusRenderer::instance().flush(); // Meldung erst nach dem letzten Frame
                     char buf[512];
                     snprintf(buf, sizeof(buf), t(Str::AUDIO_NOT_FOUND),
                              toConsole(toWideArgv(cfg.soundFile)).c_str());
-                    cout << buf << "\n";
+                    textOut() << buf << "\n";
                 } else {
+                    // Beim Start bereits dekodiert (doPreChecks); hier nur noch aus dem Cache.
+                    auto&  mixer = AudioMixer::instance();
+                    float  gain  = 1.0f;
+                    PcmPtr pcm   = loadSoundFile(cfg.soundFile, &gain);
+                    int    voice = pcm ? mixer.play(pcm, gain) : 0;
+                    mixer.mark("alarm");
                     wstring widePath = toWideArgv(cfg.soundFile);
-                    if (!widePath.empty()) {
+                    if (voice != 0 && !mixer.deviceFailed()) {
+                        if (!cfg.asyncSound) {
+                            AlarmOutcome o = waitAlarmVoice(voice);
+                            if (o != AlarmOutcome::Done) return o;
+                        }
+                    } else if (mixer.backendKind() != AudioBackend::Winmm) {
+                        // null/wav: ohne dekodierbare Datei gibt es nichts zu schreiben
+                    } else if (!widePath.empty()) {
+                        // Rückfallebene: Geraet nicht verfügbar oder Datei erst nach dem Start entstanden
                         UINT flags = SND_FILENAME | (cfg.asyncSound ? SND_ASYNC : SND_SYNC);
                         PlaySoundW(widePath.c_str(), NULL, flags);
                     } else {
+                        StatusRenderer::instance().flush();
                         char buf[512];
                         snprintf(buf, sizeof(buf), t(Str::AUDIO_PATH_ERROR),
                                  toConsole(toWideArgv(cfg.soundFile)).c_str());
-                        cout << buf << "\n";
+                        textOut() << buf << "\n";
                     }
                 }
             } catch (const fs::filesystem_error& e) {
+                StatusRenderer::instance().flush();
                 char buf[512];
                 snprintf(buf, sizeof(buf), t(Str::FILE_SYSTEM_ERROR), e.what());
-                cout << buf << "\n";
+                textOut() << buf << "\n";
             }
         } else {
-            if (cfg.asyncSound) {
-                thread([](){
-                    PlaySoundA(reinterpret_cast<LPCSTR>(sound_data), NULL, SND_MEMORY | SND_ASYNC);
-                }).detach();
-            } else {
-                PlaySoundA(reinterpret_cast<LPCSTR>(sound_data), NULL, SND_MEMORY | SND_SYNC);
+            // Eingebauter Ton über den Mixer: --async kehrt sofort zurück, ohne
+            // einen eigenen Thread pro Wiederholung; sonst bis zum Ausmischen warten.
+            auto& mixer = AudioMixer::instance();
+            float gain = 1.0f;
+            PcmPtr tone = builtinTonePcm(cfg.tone, &gain);
+            int voice = mixer.play(tone, gain);
+            mixer.mark("alarm");
+            if ((voice == 0 || mixer.deviceFailed()) && mixer.backendKind() == AudioBackend::Winmm) {
+                // Puffer muss bei SND_ASYNC über die Wiedergabe hinaus leben
+                static vector<uint8_t> fallbackWav;
+                PlaySoundA(NULL, NULL, 0); // evtl. noch laufende Wiedergabe des alten Puffers beenden
+                fallbackWav = wavFromPcm(*tone);
+                PlaySoundA(reinterpret_cast<LPCSTR>(fallbackWav.data()), NULL,
+                           SND_MEMORY | (cfg.asyncSound ? SND_ASYNC : SND_SYNC));
+            }
+            else if (!cfg.asyncSound) {
+                AlarmOutcome o = waitAlarmVoice(voice);
+                if (o != AlarmOutcome::Done) return o;
             }
         }
         if (cfg.alarmRepeat == 0 || r < cfg.alarmRepeat - 1) {
             // Nachlauf-Stille: hält den Audio-Pipeline aktiv, bis der BT-Kopfhörer
             // den Rest des Alarmtons aus seinem Puffer vollständig abgespielt hat.
-            // SND_ASYNC blockiert nicht; das Programm kann normal weiterlaufen.
-            // Die Stille endet nach 1 s von selbst, oder der nächste Tick-Loop-
-            // BT-Prewarm ersetzt sie (bei --loop).
-            if (!cfg.mute && !cfg.asyncSound)
-                PlaySoundA(reinterpret_cast<LPCSTR>(silentWav().data()),
-                           NULL, SND_MEMORY | SND_ASYNC);
-            this_thread::sleep_for(chrono::seconds(cfg.alarmInterval));
+            // Der Mixer spielt dafür zwischen den Wiederholungen durchgehend Stille.
+            if (!cfg.mute)
+                AudioMixer::instance().setKeepAlive(true);
+            AlarmOutcome o = waitAlarmKey(cfg.alarmInterval * 1000LL);
+            if (o != AlarmOutcome::Done) return o;
         }
     }
+    return AlarmOutcome::Done;
 }
 
 // Führt --cmd, --open und --focus nach Ablauf des Timers aus.
@@ -2125,24 +5814,42 @@ static void playAlarmSound(const TimerConfig& cfg) {
 // eine Fehlermeldung erscheint aber erst beim letzten Durchlauf, um die Ausgabe
 // nicht zu zerstueckeln. --cmd ist ausgenommen: dessen Ausgabe erscheint stets.
 static void runPostActions(const TimerConfig& cfg, bool warnOnFail) {
-    if (!cfg.cmdArg.empty())
-        runConsoleCommand(cfg.cmdArg);
+    auto& events = EventStream::instance();
+    if (!cfg.cmdArg.empty()) {
+        int exitCode = runConsoleCommand(cfg.cmdArg);
+        if (events.enabled()) {
+            JsonLine line = events.begin("action");
+            line.str("type", "cmd").flag("ok", exitCode == 0).num("exit_code", exitCode);
+            events.emit(line);
+        }
+    }
 
     if (!cfg.openFile.empty()) {
         bool ok = openFileAfterTimer(cfg.openFile);
         // openFileAfterTimer gibt Fehlermeldungen per \r aus; bei warnOnFail=false
         // bereits gedruckte Reste mit Leerzeichen ueberschreiben.
-        if (!ok && !warnOnFail)
+        if (!ok && !warnOnFail && !g_jsonOutput)
             cout << "\r                                                                " << flush;
+        if (events.enabled()) {
+            JsonLine line = events.begin("action");
+            line.str("type", "open").flag("ok", ok);
+            events.emit(line);
+        }
     }
 
     if (!cfg.focusWindow.empty()) {
-        if (!bringWindowToFront(cfg.focusWindow) && warnOnFail) {
+        bool ok = bringWindowToFront(cfg.focusWindow);
+        if (!ok && warnOnFail && !g_jsonOutput) {
             char buf[256];
             snprintf(buf, sizeof(buf), t(Str::WINDOW_NOT_FOUND_WARN),
                      toConsole(toWideArgv(cfg.focusWindow)).c_str());
             cout << "\r" << buf << "                                        " << flush;
         }
+        if (events.enabled()) {
+            JsonLine line = events.begin("action");
+            line.str("type", "focus").flag("ok", ok);
+            events.emit(line);
+        }
     }
 }
 
@@ -2150,18 +5857,211 @@ static void runPostActions(const TimerConfig& cfg, bool warnOnFail) {
 // ── Audio-Vorwärmung ───────────────────────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════
 
-// Initialisiert das Audio-Subsystem synchron, damit die winmm-Geräteöffnung
+// Öffnet das Mixer-Geraet synchron, damit die winmm-Geräteöffnung
 // (100–500 ms auf Frischstarts) nicht in den ersten Voralarm-Beep fällt.
 // Greift nur wenn --prealarm aktiv ist; ohne Voralarm übernimmt der
 // BT-Prewarm kurz vor dem Hauptalarm die Codec-Aktivierung.
 // Laeuft auch bei --mute: der Voralarm-Beep ist unabhaengig vom Hauptalarm-Mute
 // und benoetigt denselben Treiber-Vorlauf, sonst kommt der erste Beep zu spaet.
+// Beim Datei-Sink läuft der Mixer ab Timerstart, damit die Aufnahme den ganzen
+// Lauf abdeckt und die Markierungen auf eine gemeinsame Zeitachse fallen.
 static void doAudioPrewarm(const TimerConfig& cfg) {
-    if (cfg.preAlarmSeconds > 0) {
-        PlaySoundA(reinterpret_cast<LPCSTR>(tinyInitWav().data()),
-                   NULL, SND_MEMORY | SND_SYNC);
-        PlaySoundA(reinterpret_cast<LPCSTR>(silentWav().data()),
-                   NULL, SND_MEMORY | SND_ASYNC);
+    auto& mixer = AudioMixer::instance();
+    if (cfg.preAlarmSeconds > 0 || mixer.backendKind() == AudioBackend::WavFile)
+        mixer.open();
+    // Klänge schon jetzt synthetisieren und vermessen, nicht erst beim Ablauf
+    if (cfg.preAlarmSeconds > 0) preAlarmGain();
+    if (!cfg.mute && cfg.soundFile.empty()) builtinTonePcm(cfg.tone);
+}
+
+// Misst für das aktuelle Ausgabegeraet, wie lange das Öffnen bis zum ersten
+// ausgegebenen Sample dauert und wie viel Audio im eingeschwungenen Zustand
+// zwischen Mixer und Ausgang gepuffert ist. Jeweils der schlechteste von
+// mehreren Durchläufen wird als --audio-open-ms / --audio-latency-ms in die
+// teefax.ini geschrieben; runTimerLoop richtet Keepalive und Voralarm danach aus.
+static int runAudioCalibration() {
+    using namespace chrono;
+    constexpr int RUNS = 5;
+    auto& mixer = AudioMixer::instance();
+    // Null- und WAV-Ausgabe haben keine Geraetelatenz; ihre ~0 ms würden echte
+    // Messwerte in der INI überschreiben.
+    if (mixer.backendKind() != AudioBackend::Winmm) {
+        cout << t(Str::CALIBRATE_NEEDS_DEVICE) << "\n";
+        return 1;
+    }
+    char buf[256];
+    snprintf(buf, sizeof(buf), t(Str::CALIBRATE_START), RUNS);
+    cout << buf << "\n" << flush;
+
+    long long worstOpenMs = 0, worstLatencyMs = 0;
+    for (int run = 0; run < RUNS; ++run) {
+        mixer.close(); // jedes Mal ein geschlossenes Geraet messen
+        auto t0 = steady_clock::now();
+        if (!mixer.open()) {
+            cout << t(Str::CALIBRATE_FAILED) << "\n";
+            return 1;
+        }
+        // Öffnen + Anlaufen: bis das Geraet die ersten Samples tatsächlich ausgibt
+        while (mixer.playedSamples() <= 0 && steady_clock::now() - t0 < seconds(3))
+            this_thread::sleep_for(milliseconds(1));
+        long long openMs = duration_cast<milliseconds>(steady_clock::now() - t0).count();
+
+        // Eingeschwungen: übergebene, aber noch nicht ausgegebene Samples
+        long long queued = 0;
+        constexpr int PROBES = 50;
+        for (int p = 0; p < PROBES; ++p) {
+            this_thread::sleep_for(milliseconds(10));
+            queued += max(0LL, mixer.submittedSamples() - mixer.playedSamples());
+        }
+        long long latencyMs = queued / PROBES * 1000 / MIX_RATE;
+
+        worstOpenMs    = max(worstOpenMs, openMs);
+        worstLatencyMs = max(worstLatencyMs, latencyMs);
+    }
+    mixer.close();
+
+    snprintf(buf, sizeof(buf), t(Str::CALIBRATE_RESULT), worstOpenMs, worstLatencyMs);
+    cout << buf << "\n";
+    bool ok = saveIniSetting("--audio-open-ms", to_string(worstOpenMs)) &&
+              saveIniSetting("--audio-latency-ms", to_string(worstLatencyMs));
+    cout << t(ok ? Str::CALIBRATE_SAVED : Str::CALIBRATE_SAVE_FAILED) << "\n";
+    return ok ? 0 : 1;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ── Konfiguration beobachten (--watch-config) ──────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Beobachtet das Verzeichnis der teefax.ini mit ReadDirectoryChangesW in einem
+// eigenen Thread niedriger Priorität; der Thread schläft im Systemaufruf, bis
+// sich dort etwas ändert. Die Zeitschleife fragt nur an Durchlaufgrenzen mit
+// takeChange() ab – Änderungen wirken also frühestens ab dem nächsten Durchlauf.
+class ConfigWatcher {
+public:
+    static ConfigWatcher& instance() { static ConfigWatcher w; return w; }
+
+    // current: die beim Start ausgewertete Argumentliste (INI + expandierte
+    // Kommandozeile); rawCli: die Kommandozeile vor der Makro-Expansion. Beim
+    // Neuladen wird rawCli gegen die frische ini erneut expandiert, sodass auch
+    // geänderte Makros (teefax tee --loop) wirken; die Kommandozeile behält Vorrang.
+    void start(const vector<string>& current, vector<string> rawCli) {
+        if (dir != INVALID_HANDLE_VALUE) return;
+        const wstring& ini = getIniPath();
+        if (ini.empty()) return;
+        wstring folder = ini.substr(0, ini.rfind(L'\\') + 1);
+        dir = CreateFileW(folder.c_str(), FILE_LIST_DIRECTORY,
+                          FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                          FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+        if (dir == INVALID_HANDLE_VALUE) return;
+        cli      = move(rawCli);
+        lastArgs = current;
+        thread([this]{ threadMain(); }).detach(); // beobachtet bis Programmende
+    }
+
+    // true, wenn sich die teefax.ini seit dem letzten Aufruf geändert hat.
+    bool takeChange() { return changed.exchange(false, memory_order_acq_rel); }
+
+    // INI frisch lesen und die Kommandozeile erneut expandieren. Nur wenn sich die
+    // daraus entstehende Argumentliste geändert hat (Standardargumente oder ein
+    // benutztes Makro; fremde Makros zählen nicht), landet sie in 'args'; sonst
+    // false. Expansionsfehler (Zyklus, fehlende Argumente) verwerfen die Änderung.
+    bool reloadArgs(vector<string>& args) {
+        IniConfig::instance().release();
+        MacroCache::instance().release();
+        vector<string> fresh;
+        loadConfigArgs(fresh);
+        fresh.insert(fresh.end(), cli.begin(), cli.end());
+        bool ok = expandMacroInArgs(fresh, static_cast<int>(cli.size()) + 1);
+        IniConfig::instance().release(); // ini nicht offen halten (andere Prozesse tauschen sie aus)
+        MacroCache::instance().release();
+        if (!ok) {
+            textOut() << "\n" << t(Str::CONFIG_RELOAD_FAILED) << "\n";
+            return false;
+        }
+        if (fresh == lastArgs) return false;
+        lastArgs = fresh;
+        args     = move(fresh);
+        return true;
+    }
+
+private:
+    ConfigWatcher() = default;
+
+    void threadMain() {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+        alignas(DWORD) char buf[4096];
+        for (;;) {
+            DWORD got = 0;
+            // Schreiben, Anlegen und Umbenennen (atomarer Austausch durch --macro add)
+            if (!ReadDirectoryChangesW(dir, buf, sizeof(buf), FALSE,
+                                       FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME |
+                                       FILE_NOTIFY_CHANGE_SIZE, &got, nullptr, nullptr))
+                return;
+            if (got == 0) { changed.store(true, memory_order_release); continue; } // Puffer übergelaufen
+            for (DWORD off = 0;;) {
+                const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buf + off);
+                wstring     name(info->FileName, info->FileNameLength / sizeof(wchar_t));
+                if (_wcsicmp(name.c_str(), L"teefax.ini") == 0) changed.store(true, memory_order_release);
+                if (info->NextEntryOffset == 0) break;
+                off += info->NextEntryOffset;
+            }
+        }
+    }
+
+    HANDLE         dir = INVALID_HANDLE_VALUE;
+    vector<string> cli;
+    vector<string> lastArgs; // nur Zeitschleifen-Thread
+    atomic<bool>   changed{false};
+};
+
+// Geänderte teefax.ini an einer Durchlaufgrenze übernehmen. Nur Einstellungen,
+// die einen laufenden Zeitplan nicht berühren: Ton, Voralarm, Wiederholungen,
+// Benachrichtigung und Aktionen. Zeitangaben, Modus, Schleife und Audio-Timing
+// bleiben; Schleifenzähler und Zeitplanposition gehen so nicht verloren.
+static void applyConfigReload(TimerConfig& cfg) {
+    vector<string> args;
+    if (!ConfigWatcher::instance().reloadArgs(args)) return;
+
+    // --help/--version würden mitten im Lauf Hilfe ausgeben bzw. auf eine Taste
+    // warten: nicht ausführen, sondern die Änderung verwerfen. Fehlermeldungen
+    // von parseArguments gehen über textOut(), bei --output jsonl also nach stderr.
+    bool rejected = false;
+    for (const auto& a : args)
+        if (a == "--help" || a == "-h" || a == "--version" || a == "-v") rejected = true;
+    TimerConfig fresh;
+    textOut() << "\n";
+    if (rejected || parseArguments(args, fresh) >= 0) {
+        textOut() << t(Str::CONFIG_RELOAD_FAILED) << "\n";
+        return;
+    }
+    // Neue Sounddatei vorab prüfen; unlesbar: alte behalten
+    if (fresh.soundFile != cfg.soundFile && !fresh.soundFile.empty() && !fresh.mute &&
+        !loadSoundFile(fresh.soundFile)) {
+        char buf[512];
+        snprintf(buf, sizeof(buf), t(Str::ERROR_UNSUPPORTED_SOUND),
+                 toConsole(toWideArgv(fresh.soundFile)).c_str());
+        textOut() << buf << "\n";
+        fresh.soundFile = cfg.soundFile;
+    }
+
+    cfg.soundFile       = fresh.soundFile;
+    cfg.mute            = fresh.mute;
+    cfg.asyncSound      = fresh.asyncSound;
+    cfg.tone            = fresh.tone;
+    cfg.alarmRepeat     = fresh.alarmRepeat;
+    cfg.alarmInterval   = fresh.alarmInterval;
+    cfg.preAlarmSeconds = fresh.preAlarmSeconds;
+    cfg.showMessage     = fresh.showMessage;
+    cfg.openFile        = fresh.openFile;
+    cfg.cmdArg          = fresh.cmdArg;
+    cfg.focusWindow     = fresh.focusWindow;
+    doAudioPrewarm(cfg); // neuer Ton bzw. Voralarm: jetzt vorbereiten, nicht erst beim Ablauf
+
+    textOut() << t(Str::CONFIG_RELOADED) << "\n";
+    auto& events = EventStream::instance();
+    if (events.enabled()) {
+        JsonLine line = events.begin("config_reloaded");
+        events.emit(line);
     }
 }
 
@@ -2169,11 +6069,13 @@ static void doAudioPrewarm(const TimerConfig& cfg) {
 // ── Haupttimer-Schleife ────────────────────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════
 
+constexpr long long SNOOZE_MS = 5 * 60 * 1000; // S während des Alarms
+
 // Führt den Timer aus (ggf. mehrere Durchläufe bei --loop / --daily / --every).
-// Rückgabe: 0 bei normalem Abschluss; 1 bei Fehler (z. B. Zielzeit in Vergangenheit).
+// Rückgabe: 0 bei normalem Abschluss; 1 bei Fehler (z. B. Zielzeit in Vergangenheit);
+// 2 bei Abbruch per Taste (Esc/Q) oder über --control.
 static int runTimerLoop(TimerConfig& cfg) {
     using namespace chrono;
-    constexpr int BAR_WIDTH = 30;
 
     // TIME_CRITICAL nur im Normalmodus: verbessert Aufwach-Präzision ohne CPU-Last,
     // da der Thread nahezu die gesamte Zeit in sleep_until schläft.
@@ -2195,16 +6097,100 @@ static int runTimerLoop(TimerConfig& cfg) {
         return elapsed >= cfg.forMs;
     };
 
+    // --output jsonl: Ereignisse statt Statuszeile
+    auto&      events  = EventStream::instance();
+    const bool showBar = !events.enabled();
+    long long  iteration  = 0;
+    const char* stopReason = "completed";
+
+    // Timer-Register: Zustand für --status/--attach, nur bei Zustandswechseln geschrieben
+    TimerRegistryGuard registryGuard;
+    auto&       registry = TimerRegistry::instance();
+    TimerStatus regStatus;
+    snprintf(regStatus.mode, sizeof(regStatus.mode), "%s",
+             cfg.useDailyTimes ? "daily" : cfg.useEvery ? "every" : cfg.useAtTime ? "at" : "countdown");
+    if (!cfg.customMsg.empty())
+        snprintf(regStatus.label, sizeof(regStatus.label), "%s",
+                 fromWide(toWideArgv(cfg.customMsg), CP_UTF8).c_str());
+    regStatus.loop = cfg.loop;
+    auto publishRegistry = [&](TimerState state, long long remainingMs, long long totalMs) {
+        regStatus.state          = state;
+        regStatus.remainingMs    = remainingMs;
+        regStatus.deadlineWallMs = wallNowMs() + remainingMs;
+        regStatus.totalMs        = totalMs;
+        regStatus.loopCount      = cfg.loopCount;
+        registry.publish(regStatus);
+    };
+
+    // Tasten nur mit Konsolenleser: die Zeitschleife wartet dann auf das Tastenereignis
+    // statt zu schlafen und reagiert ohne Abfrage sofort.
+    auto&      input     = ConsoleInput::instance();
+    const bool keys      = input.available();
+    bool       snoozing  = false; // dieser Durchlauf ist ein Schlummer-Countdown
+
+    // Steuerkanal (--control): Befehle anderer Prozesse wecken dieselbe Wartestelle.
+    auto&        control      = ControlChannel::instance();
+    control.start();
+    const HANDLE controlEvent = control.event();
+    const bool   interactive  = keys || controlEvent;
+
+    // Wartet bis timeoutMs (INFINITE möglich) auf eine Taste oder einen Steuerbefehl.
+    // false: Zeit abgelaufen; true: geweckt (cmd bleibt None bei fremden Tasten).
+    auto waitCommand = [&](DWORD timeoutMs, TimerCommand& cmd) -> bool {
+        cmd = TimerCommand{};
+        if (control.pop(cmd)) return true;
+        if (keys) {
+            int key = 0;
+            if (input.waitKey(key, timeoutMs, controlEvent)) { cmd = timerKeyFor(key); return true; }
+        } else if (WaitForSingleObject(controlEvent, timeoutMs) != WAIT_OBJECT_0) {
+            return false;
+        }
+        return control.pop(cmd);
+    };
+    if (events.enabled()) {
+        const char* mode = cfg.useDailyTimes ? "daily" : cfg.useEvery ? "every"
+                         : cfg.useAtTime     ? "at"    : "countdown";
+        JsonLine line = events.begin("started");
+        line.str("version", PRG_VERSION).str("mode", mode).flag("loop", cfg.loop);
+        if (cfg.loop && cfg.maxLoops != -1) line.num("max_loops", cfg.maxLoops);
+        if (cfg.useFor)                     line.num("for_ms", cfg.forMs);
+        if (!wallMode)                      line.num("duration_ms", cfg.ms);
+        line.num("tick_ms", cfg.outputTickMs);
+        if (!cfg.customMsg.empty())
+            line.str("note", fromWide(toWideArgv(cfg.customMsg), CP_UTF8).c_str());
+        events.emit(line);
+    }
+
+    // Anzeige-Thread mit dem Titelende " | <Notiz>" (Notiz auf 30 Zeichen gekürzt)
+    // starten; der Tick veröffentlicht nur noch Zustände.
+    auto& status = StatusRenderer::instance();
+    if (showBar) {
+        wstring titleTail;
+        if (!cfg.customMsg.empty()) {
+            titleTail = toWideArgv(cfg.customMsg);
+            if (titleTail.size() > 30) titleTail = titleTail.substr(0, 30) + L"...";
+            titleTail = L" | " + titleTail;
+        }
+        status.start(titleTail.data(), static_cast<int>(titleTail.size()), cfg.smoothBar);
+    }
+
+#ifdef TEEFAX_COUNT_ALLOCS
+    unsigned long long steadyTicks = 0, steadyAllocs = 0;
+#endif
+
     do {
+        // Steuerbefehle gelten nur für den laufenden Durchlauf: Reste verwerfen.
+        control.clear();
+        control.setAccept(ControlChannel::Accept::All);
+
         // --for:
         // Countdown: ist die --for-Zeit bereits abgelaufen? Dann keinen weiteren Durchlauf starten.
         // Wanduhr:   liegt der naechste Zielzeitpunkt noch innerhalb der --for-Zeit?
-        if (cfg.useFor) {
+        // Schlummern setzt den laufenden Durchlauf fort und zählt nicht gegen --for.
+        if (cfg.useFor && !snoozing) {
             auto forElapsed = duration_cast<milliseconds>(steady_clock::now() - forStart).count();
-            if (!wallMode) {
-                if (forElapsed >= cfg.forMs) break;
-            } else {
-                if (forElapsed >= cfg.forMs) break;
+            if (forElapsed >= cfg.forMs) { stopReason = "for"; break; }
+            if (wallMode) {
                 // Naechsten Zielzeitpunkt vorausberechnen (non-destructive, kein Seiteneffekt).
                 // Fuer --at mit weit zukunftigen Daten wird msToNext direkt aus
                 // millisecondsUntilDateTime() bezogen, um system_clock-Ueberlauf zu vermeiden.
@@ -2227,14 +6213,20 @@ static int runTimerLoop(TimerConfig& cfg) {
                 }
                 if (msToNext < 0) msToNext = 0;
                 if (forElapsed + msToNext > cfg.forMs) {
-                    cout << "\n" << t(Str::FOR_TARGET_OUTSIDE);
+                    if (!g_jsonOutput) cout << "\n" << t(Str::FOR_TARGET_OUTSIDE);
+                    stopReason = "for";
                     break;
                 }
             }
         }
 
-        if (cfg.loop && cfg.loopCount < std::numeric_limits<long long>::max())
-            ++cfg.loopCount;
+        if (!snoozing) {
+            if (cfg.loop && cfg.loopCount < std::numeric_limits<long long>::max())
+                ++cfg.loopCount;
+            events.iteration.store(++iteration);
+            // --watch-config: geänderte INI erst hier, zwischen zwei Durchläufen
+            if (cfg.watchConfig && ConfigWatcher::instance().takeChange()) applyConfigReload(cfg);
+        }
 
         // ── Zielzeitpunkt für diesen Durchlauf bestimmen ──────────────
         system_clock::time_point wallTarget;
@@ -2246,7 +6238,9 @@ static int runTimerLoop(TimerConfig& cfg) {
         // WALL_SAFE_MS ist datei-weit definiert (siehe Kopf der Datei), da printStartMessage()
         // dieselbe Grenze fuer denselben Zweck benoetigt.
 
-        if (cfg.useDailyTimes) {
+        if (snoozing) {
+            wallTarget = system_clock::now() + milliseconds(SNOOZE_MS);
+        } else if (cfg.useDailyTimes) {
             wallTarget = nextDailyTarget(cfg.dailyTimes);
         } else if (cfg.useEvery) {
             wallTarget = nextEveryTarget(cfg.everySpec);
@@ -2263,7 +6257,15 @@ static int runTimerLoop(TimerConfig& cfg) {
                                                          cfg.atHour, cfg.atMinute, cfg.atSecond)
                              : millisecondsUntilTime(cfg.atHour, cfg.atMinute, cfg.atSecond);
             }
-            if (nextMs == 0) { cout << t(Str::ERROR_NEXT_TIME); return 1; }
+            if (nextMs == 0) {
+                textOut() << t(Str::ERROR_NEXT_TIME);
+                if (events.enabled()) {
+                    JsonLine line = events.begin("stopped");
+                    line.str("reason", "error").num("iterations", iteration);
+                    events.emit(line);
+                }
+                return 1;
+            }
             cfg.ms = (nextMs > MAX_MS) ? MAX_MS : nextMs;
             // wallTarget: bei cfg.ms <= WALL_SAFE_MS korrekt setzbar.
             // Bei cfg.ms > WALL_SAFE_MS wuerde system_clock::now() + milliseconds(cfg.ms)
@@ -2279,13 +6281,24 @@ static int runTimerLoop(TimerConfig& cfg) {
         // Fuer nahe Wanduhr-Ziele (daily, every, --at < 100 Jahre): wallTarget-Differenz.
         // Fuer weit-zukuenftige --at-Daten: cfg.ms direkt (wallTarget ist begrenzt, taugt
         // nicht als Restzeit-Referenz).
+        // Schlummern: fester Countdown; bei weit-zukuenftigem --at ueber die
+        // Countdown-Arithmetik, sonst ueber wallTarget.
         long long totalMsThisRound = (wallMode && cfg.ms <= WALL_SAFE_MS)
                                          ? duration_cast<milliseconds>(wallTarget - system_clock::now()).count()
-                                         : cfg.ms;
+                                         : snoozing ? SNOOZE_MS : cfg.ms;
 
         // Wanduhr-Ziel als time_t für die "morgen"-Anzeige im Balken
         time_t wallTargetT = wallMode ? system_clock::to_time_t(wallTarget) : 0;
 
+        if (events.enabled()) {
+            JsonLine line = events.begin("loop");
+            line.num("iteration", iteration).num("duration_ms", totalMsThisRound);
+            if (snoozing) line.flag("snooze", true);
+            if (wallMode && cfg.ms <= WALL_SAFE_MS)
+                line.num("target_wall_ms", duration_cast<milliseconds>(wallTarget.time_since_epoch()).count());
+            events.emit(line);
+        }
+
         // Weit-zukuenftiges --at-Datum (jenseits WALL_SAFE_MS): hier wird die Restzeit
         // NICHT ueber steady_clock-Elapsed-Arithmetik gezaehlt (Quarzdrift von 10-50 ppm
         // summiert sich ueber Jahrhunderte/Jahrtausende auf Tage bis Wochen Abweichung
@@ -2294,7 +6307,7 @@ static int runTimerLoop(TimerConfig& cfg) {
         // sicher (JDN-Fallback via millisecondsUntilDateTimeFar() jenseits des mktime-
         // Bereichs) und liest bei jedem Aufruf die aktuelle Systemzeit – somit bleibt der
         // Countdown wanduhrgenau, unabhaengig davon, wie fern das Ziel liegt.
-        const bool farAtMode = cfg.useAtDateTime && cfg.ms > WALL_SAFE_MS;
+        const bool farAtMode = cfg.useAtDateTime && cfg.ms > WALL_SAFE_MS && !snoozing;
 
         auto start = steady_clock::now();
         // 'end' als absoluter steady_clock-Zeitpunkt entfällt: würde bei
@@ -2302,20 +6315,102 @@ static int runTimerLoop(TimerConfig& cfg) {
         // (~292 Jahre) überlaufen. Countdown-Modus verwendet stattdessen
         // Elapsed-Time-Arithmetik (nowSteady - start).
 
-        // Benutzerdefinierte Notiz für Fenstertitel vorbereiten (einmalig pro Durchlauf)
-        wstring customMsgW;
-        if (!cfg.customMsg.empty()) {
-            customMsgW = toWideArgv(cfg.customMsg);
-            if (customMsgW.size() > 30) customMsgW = customMsgW.substr(0, 30) + L"...";
-        }
+        // Audio-Vorlauf: Geraet-Öffnung + Ausgabelatenz (gemessen mit --calibrate-audio,
+        // sonst Standardwerte). Ergibt ohne Kalibrierung die bisherigen 2 s Keepalive-
+        // bzw. Voralarm + 3 s Vorlauf.
+        const long long keepAliveLeadSec =
+            max(2LL, 1 + (static_cast<long long>(cfg.audioOpenMs) + cfg.audioLatencyMs + 999) / 1000);
+
+        // Metronom läuft für die Dauer dieses Durchlaufs mit; Abstände kommen aus dem Audiotakt
+        int  clickVoice = 0;
+        auto startClick = [&]{
+            if (cfg.clickPeriodSamples > 0.0)
+                clickVoice = AudioMixer::instance().play(
+                    make_shared<ClickTrack>(cfg.clickPeriodSamples, cfg.accentPattern));
+        };
+        startClick();
+
+        publishRegistry(TimerState::Running, totalMsThisRound, totalMsThisRound);
 
         // ── Tick-Schleife: Fortschrittsbalken und Voralarm ────────────
+        status.reset(); // seit dem letzten Durchlauf kann beliebig ausgegeben worden sein
+        auto            nextEventTick      = start; // --output jsonl: nächstes Tick-Ereignis
+        int             lastBarStep        = -1;
         long long       lastVerbleibendSec = -1;
         bool            soundPrewarmed     = false; // BT-Prewarm: einmalig pro Durchlauf
         bool            preAlarmStarted    = false; // Voralarm-WAV: einmalig pro Durchlauf
-        vector<uint8_t> preAlarmWavBuf;             // hält Voralarm-Puffer am Leben (SND_ASYNC)
-
+        int             preAlarmVoice      = 0;     // Mixer-Stimme des Voralarms
+        bool            cancelled          = false; // Esc/Q: Timer ohne Alarm beenden
+
+        // Pause und +1 Minute: Voralarm, Vorwärmung und Metronom passen nicht mehr
+        // zur neuen Restzeit und werden neu aufgebaut bzw. angehalten.
+        auto resetAudioLead = [&]{
+            auto& mixer = AudioMixer::instance();
+            if (preAlarmVoice) { mixer.stop(preAlarmVoice); preAlarmVoice = 0; }
+            if (soundPrewarmed || preAlarmStarted) mixer.setKeepAlive(false);
+            soundPrewarmed  = false;
+            preAlarmStarted = false;
+        };
+
+        // Aktuelle Restzeit, frisch gemessen (Befehle treffen zwischen zwei Ticks ein).
+        auto remainingNow = [&]() -> long long {
+            if (wallMode && cfg.ms <= WALL_SAFE_MS)
+                return duration_cast<milliseconds>(wallTarget - system_clock::now()).count();
+            return totalMsThisRound - duration_cast<milliseconds>(steady_clock::now() - start).count();
+        };
+
+        // Restzeit um deltaMs verschieben (+1 Minute, add/sub, target); die Durchlauf-
+        // länge wächst mit, damit der Balken nicht springt.
+        auto adjustRemaining = [&](long long deltaMs, long long remainingBefore, TimerState state) {
+            totalMsThisRound += deltaMs;
+            wallTarget       += milliseconds(deltaMs);
+            if (wallMode) wallTargetT = system_clock::to_time_t(wallTarget);
+            resetAudioLead();
+            publishRegistry(state, remainingBefore + deltaMs, totalMsThisRound);
+            if (events.enabled()) {
+                JsonLine line = events.begin("adjusted");
+                line.num("iteration", iteration).num("delta_ms", deltaMs)
+                    .num("remaining_ms", remainingBefore + deltaMs);
+                events.emit(line);
+            }
+            lastVerbleibendSec = -1;
+            lastBarStep        = -1;
+        };
+
+        // target: Differenz zur gewünschten Restzeit bzw. zur nächsten Uhrzeit.
+        auto targetDelta = [&](const TimerCommand& c, long long remainingBefore) -> long long {
+            long long wanted = c.kind == TimerCmd::TargetAt
+                                   ? millisecondsUntilTime(c.hour, c.minute, c.second)
+                                   : c.ms;
+            return wanted - remainingBefore;
+        };
+
+        // Pausenanzeige: eingefrorene Restzeit mit Hinweis in Balken und Fenstertitel.
+        auto showPaused = [&](long long remainingMs) {
+            if (!showBar) return;
+            StatusFrame& f = status.frame();
+            int n = formatVerbleibendTo(f.remaining, sizeof(f.remaining), (max(0LL, remainingMs) + 999) / 1000);
+            n += snprintf(f.remaining + n, sizeof(f.remaining) - n, " %s", t(Str::STOPWATCH_PAUSED));
+            f.remainingLen = min(n, static_cast<int>(sizeof(f.remaining)) - 1);
+            f.loop        = cfg.loop;
+            f.loopCount   = cfg.loopCount;
+            f.wallTargetT = wallTargetT;
+            f.fraction    = totalMsThisRound > 0
+                                ? min(max(1.0 - static_cast<double>(remainingMs) / totalMsThisRound, 0.0), 1.0)
+                                : 1.0;
+            f.setTitle    = true;
+            f.newline     = false;
+            status.publish();
+        };
+
+#ifdef TEEFAX_COUNT_ALLOCS
+        bool firstTick = true;
+#endif
         while (true) {
+#ifdef TEEFAX_COUNT_ALLOCS
+            const unsigned long long allocsBefore   = g_allocCount.load();
+            const bool               preAlarmBefore = preAlarmStarted;
+#endif
             auto nowSteady = steady_clock::now();
             auto nowWall   = system_clock::now();
 
@@ -2339,120 +6434,247 @@ static int runTimerLoop(TimerConfig& cfg) {
                 verbleibendMs = totalMsThisRound - steadyElapsedMs;
                 if (verbleibendMs <= 0) done = true;
             }
-            if (done) break;
+            if (done) {
+                AudioMixer::instance().mark("deadline");
+                publishRegistry(TimerState::Alarm, 0, totalMsThisRound);
+                if (events.enabled()) {
+                    JsonLine line = events.begin("fired");
+                    line.num("iteration", iteration).num("late_ms", -verbleibendMs);
+                    events.emit(line);
+                }
+                break;
+            }
             if (verbleibendMs < 0) verbleibendMs = 0;
 
+            // Fortschritt und sichtbarer Balkenschritt (Zellen bzw. Achtelzellen)
+            long long elapsedMs = totalMsThisRound - verbleibendMs;
+            if (elapsedMs < 0) elapsedMs = 0;
+            double fraction = (totalMsThisRound > 0)
+                                  ? static_cast<double>(elapsedMs) / static_cast<double>(totalMsThisRound)
+                                  : 1.0;
+            fraction = min(max(fraction, 0.0), 1.0);
+            const int barRes  = showBar ? status.resolution() : 0;
+            const int barStep = static_cast<int>(fraction * barRes);
+
+            // Tick-Ereignis im Takt von --output-tick; nur gepuffert, nie einzeln geschrieben
+            if (events.enabled() && nowSteady >= nextEventTick) {
+                nextEventTick += milliseconds(cfg.outputTickMs);
+                if (nextEventTick <= nowSteady) nextEventTick = nowSteady + milliseconds(cfg.outputTickMs);
+                JsonLine line = events.begin("tick");
+                line.num("iteration", iteration).num("remaining_ms", verbleibendMs)
+                    .real("fraction", fraction);
+                events.emit(line, false);
+            }
+
             long long verbleibendSec = (verbleibendMs + 999) / 1000;
+            const bool secondChanged = farAtMode || verbleibendSec != lastVerbleibendSec;
 
             // farAtMode: verbleibendSec bleibt wegen der MAX_MS-Deckelung praktisch konstant
             // (siehe millisecondsUntilDateTimeFar) und wuerde die Anzeige sonst nach dem ersten
             // Tick einfrieren lassen. Daher hier ungebremst jede Sekunde neu zeichnen – die
-            // tatsaechliche Aenderung liefert formatVerbleibendFar() weiter unten ohnehin frisch.
-            if (farAtMode || verbleibendSec != lastVerbleibendSec) {
+            // tatsaechliche Aenderung liefert formatVerbleibendFarTo() weiter unten ohnehin frisch.
+            if (secondChanged) {
                 lastVerbleibendSec = verbleibendSec;
 
                 // BT-Vorwärmung kurz vor Ablauf (nur ohne Voralarm).
                 // Mit aktivem Voralarm übernimmt die Voralarm-WAV die Codec-Aktivierung.
                 if (!cfg.mute && !soundPrewarmed &&
-                    cfg.preAlarmSeconds == 0 && verbleibendSec > 0 && verbleibendSec <= 2)
+                    cfg.preAlarmSeconds == 0 && verbleibendSec > 0 && verbleibendSec <= keepAliveLeadSec)
                 {
                     soundPrewarmed = true;
-                    PlaySoundA(reinterpret_cast<LPCSTR>(silentWav().data()),
-                               NULL, SND_MEMORY | SND_ASYNC | SND_LOOP);
+                    AudioMixer::instance().setKeepAlive(true);
                 }
 
                 // Voralarm: einmalig pro Durchlauf aufbauen und starten.
                 // Der WAV-Puffer enthält Stille (BT-Prewarm) gefolgt von allen Beeps
                 // als kontinuierlichen Stream – kein SND_LOOP, endet nach letztem Beep.
                 if (cfg.preAlarmSeconds > 0 && !preAlarmStarted &&
-                    verbleibendSec > 0 && verbleibendSec <= static_cast<long long>(cfg.preAlarmSeconds) + 3)
+                    verbleibendSec > 0 &&
+                    verbleibendSec <= static_cast<long long>(cfg.preAlarmSeconds) + keepAliveLeadSec + 1)
                 {
                     preAlarmStarted = true;
                     int beepCount = static_cast<int>(
                         min(verbleibendSec, static_cast<long long>(cfg.preAlarmSeconds)));
-                    // Stille-Prewarm auf den ersten Sekundentick ausrichten.
-                    // Mindest 500 ms: sichert BT-Codec-Aktivierung auch bei kurzen Timern.
+                    // Stille-Prewarm auf den ersten Sekundentick ausrichten, abzüglich der
+                    // gemessenen Ausgabelatenz (sonst erklingt jeder Beep um sie verspätet).
+                    // Mindestdauer = Öffnungszeit: sichert BT-Codec-Aktivierung auch bei kurzen Timern.
                     int prewarmMs = static_cast<int>(
-                        verbleibendMs - static_cast<long long>(beepCount) * 1000LL);
-                    if (prewarmMs < 500) prewarmMs = 500;
-                    preAlarmWavBuf = buildPreAlarmWav(beepCount, prewarmMs);
-                    if (!preAlarmWavBuf.empty())
-                        PlaySoundA(reinterpret_cast<LPCSTR>(preAlarmWavBuf.data()),
-                                   NULL, SND_MEMORY | SND_ASYNC);
+                        verbleibendMs - static_cast<long long>(beepCount) * 1000LL - cfg.audioLatencyMs);
+                    if (prewarmMs < cfg.audioOpenMs) prewarmMs = cfg.audioOpenMs;
+                    vector<uint8_t> wav = buildPreAlarmWav(beepCount, prewarmMs);
+                    if (!wav.empty()) {
+                        // Keepalive schon jetzt: nach dem letzten Beep bleibt der Codec
+                        // aktiv, bis playAlarmSound() den eigentlichen Alarmton mischt.
+                        auto& mixer = AudioMixer::instance();
+                        if (!cfg.mute) mixer.setKeepAlive(true);
+                        preAlarmVoice = mixer.play(pcmFromWav(wav.data(), wav.size()), preAlarmGain());
+                        mixer.mark("prealarm");
+                        if (events.enabled()) {
+                            JsonLine line = events.begin("prealarm");
+                            line.num("iteration", iteration).num("beeps", beepCount);
+                            events.emit(line);
+                        }
+                    }
                 }
+            }
 
-                // Fortschrittsbalken aktualisieren
-                long long  elapsedMs = totalMsThisRound - verbleibendMs;
-                if (elapsedMs < 0) elapsedMs = 0;
-                long double fraction = (totalMsThisRound > 0)
-                                           ? static_cast<long double>(elapsedMs) / static_cast<long double>(totalMsThisRound)
-                                           : 1.0L;
-                if (fraction < 0.0L) fraction = 0.0L;
-                if (fraction > 1.0L) fraction = 1.0L;
-
-                string verbleibendStr = farAtMode
-                                            ? formatVerbleibendFar(cfg.atYear, cfg.atMonth, cfg.atDay,
-                                                                   cfg.atHour, cfg.atMinute, cfg.atSecond)
-                                            : formatVerbleibend(verbleibendSec);
-                string prefix         = buildBarPrefix(cfg.loop, cfg.loopCount,
-                                               verbleibendStr, wallTargetT);
-                // Fenstertitel einmal pro Sekunde
-                {
-                    wstring titleW = L"Teefax - " + wstring(verbleibendStr.begin(), verbleibendStr.end());
-                    if (!customMsgW.empty()) titleW += L" | " + customMsgW;
-                    SetConsoleTitleW(titleW.c_str());
-                }
+            // Fortschrittsbalken: Zustand an den Anzeige-Thread übergeben – bei
+            // neuer Restzeit-Sekunde oder wenn der Balken einen Schritt weiter ist.
+            // Alles in feste Puffer: der eingeschwungene Tick allokiert nichts.
+            if (showBar && (secondChanged || barStep != lastBarStep)) {
+                lastBarStep = barStep;
+                StatusFrame& f = status.frame();
+                f.remainingLen = farAtMode
+                                     ? formatVerbleibendFarTo(f.remaining, sizeof(f.remaining),
+                                                              cfg.atYear, cfg.atMonth, cfg.atDay,
+                                                              cfg.atHour, cfg.atMinute, cfg.atSecond)
+                                     : formatVerbleibendTo(f.remaining, sizeof(f.remaining), verbleibendSec);
+                f.loop        = cfg.loop;
+                f.loopCount   = cfg.loopCount;
+                f.wallTargetT = wallTargetT;
+                f.fraction    = fraction;
+                f.setTitle    = secondChanged; // Fenstertitel einmal pro Sekunde: "Teefax - <Restzeit>[ | <Notiz>]"
+                f.newline     = false;
+                status.publish();
+            }
 
-                int effBar = calcEffectiveBarWidth(static_cast<int>(prefix.size()), BAR_WIDTH);
-                int filled = (effBar > 0)
-                                 ? min(static_cast<int>(fraction * effBar), effBar) : 0;
-                renderBar(prefix, filled, effBar);
+#ifdef TEEFAX_COUNT_ALLOCS
+            // Der erste Tick (Layout, statische Caches) und der Voralarm-Start dürfen allokieren.
+            if (!firstTick && preAlarmStarted == preAlarmBefore) {
+                ++steadyTicks;
+                steadyAllocs += g_allocCount.load() - allocsBefore;
             }
+            firstTick = false;
+#endif
 
             // Bis zur nächsten Sekundengrenze schlafen.
             // Nahe Wanduhr-Ziele (cfg.ms <= WALL_SAFE_MS): wall-clock-basierter Schlaf;
             //   NTP-Korrekturen wirken; Obergrenze 1,5 s verhindert Einfrieren bei Sprüngen.
             // Countdown und weit-zukuenftige --at-Daten: steady_clock-relativer Schlaf,
             //   kein Ueberlauf, kein Drift.
+            // --output jsonl bzw. Balken: früher aufwachen, wenn vorher ein Tick-Ereignis
+            // fällig ist oder der Balken sichtbar weiterrückt – kein fester Bildtakt.
             if (verbleibendSec >= 1) {
+                steady_clock::time_point wakeAt;
                 if (wallMode && cfg.ms <= WALL_SAFE_MS) {
                     auto nextWallTick   = wallTarget - seconds(verbleibendSec - 1);
                     auto durationToTick = nextWallTick - system_clock::now();
                     if (durationToTick > milliseconds(1500))
                         durationToTick = milliseconds(1500);
-                    if (durationToTick > milliseconds(0))
-                        this_thread::sleep_until(steady_clock::now() +
-                                                 duration_cast<milliseconds>(durationToTick));
+                    if (durationToTick < milliseconds(0))
+                        durationToTick = milliseconds(0);
+                    wakeAt = steady_clock::now() + duration_cast<milliseconds>(durationToTick);
                 } else {
                     // Millisekunden bis zur nächsten vollen Sekundengrenze (immer 1..1000 ms).
                     // nowSteady + kleiner Wert bleibt weit unterhalb der steady_clock-Reichweite.
                     long long msUntilNextTick = verbleibendMs - (verbleibendSec - 1) * 1000LL;
-                    this_thread::sleep_until(nowSteady + milliseconds(msUntilNextTick));
+                    wakeAt = nowSteady + milliseconds(msUntilNextTick);
+                }
+                if (events.enabled() && nextEventTick < wakeAt) wakeAt = nextEventTick;
+                // Nächster Balkenschritt: genau dann aufwachen, höchstens alle BAR_MIN_FRAME_MS
+                if (barRes > 0 && barStep < barRes) {
+                    double    stepMs    = static_cast<double>(totalMsThisRound) / barRes;
+                    long long untilStep = static_cast<long long>(ceil((barStep + 1) * stepMs)) - elapsedMs;
+                    if (untilStep < BAR_MIN_FRAME_MS) untilStep = BAR_MIN_FRAME_MS;
+                    if (untilStep < 2000 && nowSteady + milliseconds(untilStep) < wakeAt)
+                        wakeAt = nowSteady + milliseconds(untilStep);
+                }
+
+                // Mit Tasten bzw. Steuerkanal bis kurz vor wakeAt auf einen Befehl warten
+                // (die Wartefunktionen kennen nur ganze Millisekunden), den Rest schlafen.
+                TimerCommand cmd;
+                bool         woke = false;
+                if (interactive) {
+                    long long left = duration_cast<milliseconds>(wakeAt - steady_clock::now()).count();
+                    if (left > 0) woke = waitCommand(static_cast<DWORD>(left), cmd);
+                }
+                if (!woke) {
+                    this_thread::sleep_until(wakeAt);
+                    continue;
+                }
+
+                // Weit-zukuenftige --at-Daten folgen der Wanduhr: nur Abbruch wirkt.
+                if (farAtMode && cmd.kind != TimerCmd::Cancel) cmd.kind = TimerCmd::None;
+
+                // Pause: Restzeit einfrieren, bis Weiter (Leertaste/P, resume) oder Abbruch.
+                // Zeitänderungen während der Pause gelten für die eingefrorene Restzeit.
+                if (cmd.kind == TimerCmd::TogglePause || cmd.kind == TimerCmd::Pause) {
+                    auto      pausedAt        = steady_clock::now();
+                    long long pausedRemaining = remainingNow();
+                    resetAudioLead();
+                    if (clickVoice) { AudioMixer::instance().stop(clickVoice); clickVoice = 0; }
+                    showPaused(pausedRemaining);
+                    publishRegistry(TimerState::Paused, pausedRemaining, totalMsThisRound);
+                    if (events.enabled()) {
+                        JsonLine line = events.begin("paused");
+                        line.num("iteration", iteration).num("remaining_ms", pausedRemaining);
+                        events.emit(line);
+                    }
+                    for (;;) {
+                        if (!waitCommand(INFINITE, cmd)) continue;
+                        if (cmd.kind == TimerCmd::TogglePause || cmd.kind == TimerCmd::Resume ||
+                            cmd.kind == TimerCmd::Cancel)
+                            break;
+                        long long delta = 0;
+                        if (cmd.kind == TimerCmd::Adjust) delta = cmd.ms;
+                        else if (cmd.kind == TimerCmd::TargetIn || cmd.kind == TimerCmd::TargetAt)
+                            delta = targetDelta(cmd, pausedRemaining);
+                        else continue;
+                        adjustRemaining(delta, pausedRemaining, TimerState::Paused);
+                        pausedRemaining += delta;
+                        showPaused(pausedRemaining);
+                    }
+
+                    // Ziel um die Pausendauer verschieben (Countdown: Startpunkt, Wanduhr: Ziel)
+                    auto pausedFor = steady_clock::now() - pausedAt;
+                    start         += pausedFor;
+                    nextEventTick += pausedFor;
+                    wallTarget    += duration_cast<system_clock::duration>(pausedFor);
+                    if (wallMode) wallTargetT = system_clock::to_time_t(wallTarget);
+                    if (cmd.kind != TimerCmd::Cancel) {
+                        startClick();
+                        publishRegistry(TimerState::Running, pausedRemaining, totalMsThisRound);
+                        if (events.enabled()) {
+                            JsonLine line = events.begin("resumed");
+                            line.num("iteration", iteration)
+                                .num("paused_ms", duration_cast<milliseconds>(pausedFor).count());
+                            events.emit(line);
+                        }
+                    }
+                    lastVerbleibendSec = -1; // neu zeichnen, Titel ohne Pausenhinweis
+                    lastBarStep        = -1;
+                } else if (cmd.kind == TimerCmd::Adjust) {
+                    adjustRemaining(cmd.ms, remainingNow(), TimerState::Running);
+                } else if (cmd.kind == TimerCmd::TargetIn || cmd.kind == TimerCmd::TargetAt) {
+                    long long before = remainingNow();
+                    adjustRemaining(targetDelta(cmd, before), before, TimerState::Running);
+                }
+                if (cmd.kind == TimerCmd::Cancel) {
+                    cancelled = true;
+                    break;
                 }
             }
         }
         // ── Ende Tick-Schleife ────────────────────────────────────────
 
-        // Voralarm-Stream explizit beenden: der WAV-Puffer ist rechnerisch auf das
-        // Timer-Ende ausgelegt, läuft aber durch die Laufzeit von buildPreAlarmWav()
-        // und dem PlaySoundA-Aufruf selbst um einige Millisekunden über das Ende
-        // hinaus. PlaySoundA(nullptr, ...) stoppt jede laufende Wiedergabe sauber,
-        // statt sie beim Programmende abrupt mitten in der Stille abzuschneiden
-        // (Ursache des Knackens). Ohne aktiven Voralarm ist der Aufruf wirkungslos.
-        if (preAlarmStarted) {
-            PlaySoundA(nullptr, nullptr, 0); // Voralarm sauber stoppen (vermeidet Knacken)
-            // Sofort Stille-Loop starten, damit der BT-Codec aktiv bleibt,
-            // bis playAlarmSound() den eigentlichen Alarmton startet.
-            if (!cfg.mute)
-                PlaySoundA(reinterpret_cast<LPCSTR>(silentWav().data()),
-                           NULL, SND_MEMORY | SND_ASYNC | SND_LOOP);
-        }
-
-        // Vollständiger Balken am Ende des Durchlaufs
-        {
-            string prefix = buildBarPrefix(cfg.loop, cfg.loopCount, "00:00", 0);
-            int effBar    = calcEffectiveBarWidth(static_cast<int>(prefix.size()), BAR_WIDTH);
-            renderBar(prefix, effBar, effBar);
+        // Voralarm-Stimme beenden: der Puffer ist rechnerisch auf das Timer-Ende
+        // ausgelegt, läuft durch die Laufzeit von buildPreAlarmWav() aber um einige
+        // Millisekunden Stille darüber hinaus. Da der Mixer das Geraet offen hält,
+        // entfällt das frühere Stoppen und Neustarten des Stille-Loops.
+        if (preAlarmVoice) AudioMixer::instance().stop(preAlarmVoice);
+        if (clickVoice)    AudioMixer::instance().stop(clickVoice);
+
+        // Abbruch per Taste: kein Alarm, keine Aktionen, keine weiteren Durchläufe.
+        if (cancelled) {
+            AudioMixer::instance().setKeepAlive(false);
+            status.flush();
+            if (!g_jsonOutput) cout << "\n" << t(Str::TIMER_CANCELLED) << "\n" << flush;
+            if (events.enabled()) {
+                JsonLine line = events.begin("stopped");
+                line.str("reason", "cancelled").num("iterations", iteration);
+                events.emit(line);
+            }
+            return 2;
         }
 
         // Zeilenumbruch: immer beim letzten Durchlauf; immer wenn --cmd folgt,
@@ -2460,20 +6682,54 @@ static int runTimerLoop(TimerConfig& cfg) {
         bool isLastIteration = !cfg.loop
                                || (cfg.maxLoops != -1 && cfg.loopCount >= cfg.maxLoops)
                                || forWouldStop();
-        if (isLastIteration || !cfg.cmdArg.empty())
-            cout << "\n" << flush;
 
-        if (!cfg.mute) playAlarmSound(cfg);
+        // Vollständiger Balken am Ende des Durchlaufs. Nur veröffentlichen: der
+        // Alarm startet, ohne auf die Konsole zu warten.
+        if (showBar) {
+            StatusFrame& f = status.frame();
+            memcpy(f.remaining, "00:00", 6);
+            f.remainingLen = 5;
+            f.loop        = cfg.loop;
+            f.loopCount   = cfg.loopCount;
+            f.wallTargetT = 0;
+            f.fraction    = 1.0;
+            f.setTitle    = false;
+            f.newline     = isLastIteration || !cfg.cmdArg.empty();
+            status.publish();
+        }
+
+        control.setAccept(ControlChannel::Accept::CancelOnly); // beendet nur den Alarm
+        AlarmOutcome alarm = cfg.mute ? AlarmOutcome::Done : playAlarmSound(cfg);
+        control.setAccept(ControlChannel::Accept::None);
+        status.flush(); // ab hier schreibt wieder der Tick-Thread
+        // Keepalive freigeben; der Mixer schliesst das Geraet erst nach
+        // MIX_IDLE_CLOSE_SEC Leerlauf, kurze Schleifen behalten es also offen.
+        AudioMixer::instance().setKeepAlive(false);
+
+        // Schlummern: derselbe Durchlauf klingelt nach SNOOZE_MS erneut; Aktionen und
+        // Benachrichtigung erst, wenn der Alarm wirklich endet.
+        snoozing = alarm == AlarmOutcome::Snoozed;
+        if (snoozing) {
+            if (events.enabled()) {
+                JsonLine line = events.begin("snoozed");
+                line.num("iteration", iteration).num("duration_ms", SNOOZE_MS);
+                events.emit(line);
+            }
+            continue;
+        }
 
         // Konsolenmodus wiederherstellen, damit Kindprozesse den Originalzustand erben.
         restoreConsoleMode();
 
+        // Eingabeleser pausieren: --cmd-Kindprozesse sollen ihre Eingaben selbst erhalten.
+        ConsoleInput::instance().suspend();
         runPostActions(cfg, isLastIteration);
 
         // QuickEdit für den nächsten Durchlauf neu deaktivieren.
         // --cmd-Kindprozesse und restoreConsoleMode() schalten QuickEdit zurück;
         // bei --daily/--every ohne --cmd tut restoreConsoleMode() dasselbe.
         if (cfg.loop) disableQuickEdit();
+        ConsoleInput::instance().resume();
 
         // Fenstertitel zurücksetzen, bevor die Benachrichtigung den Thread blockiert.
         SetConsoleTitleA("Teefax");
@@ -2484,10 +6740,22 @@ static int runTimerLoop(TimerConfig& cfg) {
             showNotification(toWide(t(Str::NOTIFY_TITLE)), notifyText);
         }
 
-    } while (cfg.loop
-             && (cfg.maxLoops == -1 || cfg.loopCount < cfg.maxLoops)
-             && !forWouldStop());
+    } while (snoozing
+             || (cfg.loop
+                 && (cfg.maxLoops == -1 || cfg.loopCount < cfg.maxLoops)
+                 && !forWouldStop()));
 
+    if (events.enabled()) {
+        JsonLine line = events.begin("stopped");
+        line.str("reason", stopReason).num("iterations", iteration);
+        events.emit(line);
+    }
+
+#ifdef TEEFAX_COUNT_ALLOCS
+    fprintf(stderr, "alloccheck: %llu allocations in %llu steady-state ticks\n",
+            steadyAllocs, steadyTicks);
+    if (steadyAllocs > 0) return 3;
+#endif
     return 0;
 }
 
@@ -2515,8 +6783,21 @@ int main(int argc, char* argv[])
         if (result >= 0) return result;
     }
 
+    // --sw: benannte Stoppuhr bedienen und sofort beenden
+    {
+        int result = handleNamedStopwatch(args);
+        if (result >= 0) return result;
+    }
+
+    // --status / --attach / --control: laufende Timer anzeigen bzw. steuern und sofort beenden
+    {
+        int result = handleRegistryCommands(args);
+        if (result >= 0) return result;
+    }
+
     // Makro-Expansion: ersten passenden CLI-Makronamen ersetzen
-    expandMacroInArgs(args, argc);
+    if (!expandMacroInArgs(args, argc)) return 1;
+    IniConfig::instance().release(); // laufende Timer halten die ini nicht offen
 
     // Systemprioritäten und Signal-Handler
     SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_ABOVE_NORMAL);
@@ -2557,7 +6838,8 @@ int main(int argc, char* argv[])
 
     // Grundlegende Validierung
     if (!cfg.useAtTime && !cfg.useDailyTimes && !cfg.useEvery &&
-        !cfg.showLiveTime && !cfg.showStopwatch && cfg.ms <= 0) {
+        !cfg.showLiveTime && !cfg.showStopwatch && !cfg.calibrateAudio &&
+        cfg.clickPeriodSamples <= 0.0 && cfg.ms <= 0) {
         cout << t(Str::ERROR_NO_TIME) << "\n";
         restoreConsoleMode();
         return 1;
@@ -2579,13 +6861,34 @@ int main(int argc, char* argv[])
 
     if (cfg.noSleep) preventSleep(true);
 
-    if (!cfg.showLiveTime && !cfg.showStopwatch)
+    configureAudioBackend(cfg.audioBackend);
+    if (cfg.calibrateAudio) {
+        int rc = runAudioCalibration();
+        restoreConsoleMode();
+        return rc;
+    }
+
+    // Metronom ohne Zeitangabe: eigener Modus statt Countdown
+    const bool metronomeOnly = cfg.clickPeriodSamples > 0.0 && !cfg.useAtTime &&
+                               !cfg.useDailyTimes && !cfg.useEvery && cfg.ms <= 0;
+
+    // --output jsonl gilt nur für den Timer; die interaktiven Modi bleiben Text
+    if (cfg.jsonOutput && !cfg.showLiveTime && !cfg.showStopwatch && !metronomeOnly) {
+        g_jsonOutput = true;
+        EventStream::instance().enable();
+    }
+
+    if (!cfg.showLiveTime && !cfg.showStopwatch && !metronomeOnly && !g_jsonOutput)
         printStartMessage(cfg);
-    doPreChecks(cfg);
+    if (!doPreChecks(cfg)) return 1;
+
+    // Größenänderungen und Tasten ab hier ereignisgesteuert
+    ConsoleInput::instance().start();
 
     // Interaktive Modi laufen bis Strg+C
     if (cfg.showLiveTime)  return runLiveClockMode();
-    if (cfg.showStopwatch) return runStopwatchMode();
+    if (cfg.showStopwatch) return runStopwatchMode(cfg.stopwatchFps, cfg.lapsFile);
+    if (metronomeOnly)     return runMetronomeMode(cfg);
 
     // Im Eco-Modus wurde timeBeginPeriod bewusst nicht aufgerufen;
     // die Warnung soll nur bei unerwarteten Fehlern im Normalmodus erscheinen.
@@ -2594,10 +6897,19 @@ int main(int argc, char* argv[])
 
     doAudioPrewarm(cfg);
 
+    // --watch-config: INI-Änderungen an Durchlaufgrenzen übernehmen
+    if (cfg.watchConfig)
+        ConfigWatcher::instance().start(args, vector<string>(argv + 1, argv + argc));
+
+    // Tastenbelegung nur, wenn Tasten auch ankommen (Konsole als Eingabe)
+    if (ConsoleInput::instance().available() && !g_jsonOutput)
+        cout << t(Str::TIMER_KEYS_HINT) << "\n";
+
     // Timer ausführen
     int result = runTimerLoop(cfg);
 
-    if (result == 0) cout << t(Str::TIMER_ENDED);
+    if (result == 0 && !g_jsonOutput) cout << t(Str::TIMER_ENDED);
+    AudioMixer::instance().shutdown();
     if (cfg.noSleep) preventSleep(false);
     restoreConsoleMode();
 
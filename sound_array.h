@@ -1,2 +0,0 @@
-const unsigned char sound_data[] = {82,73,70,70,158,71,0,0,87,65,86,69,102,109,116,32,16,0,0,0,1,0,1,0,34,86,0,0,68,172,0,0,2,0,16,0,100,97,116,97,138,70,0,0,34,0,40,0,27,0,41,0,18,0,28,0,17,0,3,0,20,0,19,0,15,0,10,0,0,0,7,0,22,0,250,255,21,0,247,255,11,0,237,255,3,0,255,255,235,255,17,0,2,0,8,0,1,0,253,255,247,255,254,255,234,255,232,255,245,255,235,255,246,255,239,255,230,255,243,255,239,255,232,255,250,255,233,255,250,255,233,255,224,255,232,255,237,255,251,255,237,255,237,255,252,255,254,255,241,255,8,0,237,255,232,255,6,0,230,255,6,0,7,0,250,255,245,255,232,255,244,255,251,255,3,0,252,255,252,255,244,255,222,255,16,0,246,255,249,255,255,255,238,255,7,0,246,255,248,255,4,0,244,255,246,255,8,0,248,255,14,0,6,0,251,255,252,255,253,255,2,0,20,0,1,0,21,0,22,0,238,255,4,0,254,255,25,0,255,255,23,0,11,0,253,255,14,0,10,0,255,255,21,0,18,0,2,0,20,0,11,0,4,0,14,0,13,0,250,255,253,255,252,255,7,0,243,255,252,255,8,0,251,255,255,255,245,255,250,255,6,0,238,255,221,255,251,255,226,255,247,255,249,255,243,255,247,255,246,255,4,0,225,255,250,255,235,255,245,255,5,0,1,0,13,0,2,0,0,0,253,255,250,255,4,0,12,0,8,0,9,0,250,255,13,0,14,0,237,255,22,0,20,0,247,255,4,0,9,0,249,255,250,255,17,0,247,255,253,255,5,0,7,0,20,0,214,255,241,255,0,0,248,255,19,0,12,0,24,0,242,255,253,255,0,0,248,255,6,0,20,0,255,255,17,0,244,255,241,255,255,255,252,255,14,0,11,0,6,0,254,255,12,0,7,0,14,0,14,0,9,0,8,0,23,0,7,0,17,0,18,0,4,0,11,0,245,255,13,0,251,255,6,0,2,0,12,0,15,0,4,0,233,255,10,0,253,255,255,255,16,0,0,0,9,0,4,0,255,255,4,0,251,255,10,0,10,0,1,0,254,255,251,255,245,255,6,0,242,255,7,0,249,255,250,255,255,255,9,0,0,0,8,0,4,0,236,255,252,255,24,0,239,255,18,0,7,0,4,0,34,0,18,0,20,0,3,0,21,0,11,0,9,0,2,0,10,0,14,0,13,0,252,255,4,0,255,255,8,0,0,0,0,0,13,0,19,0,2,0,19,0,38,0,245,255,19,0,17,0,11,0,17,0,7,0,7,0,27,0,30,0,10,0,19,0,29,0,7,0,3,0,7,0,239,255,247,255,251,255,8,0,245,255,9,0,252,255,232,255,245,255,247,255,239,255,242,255,246,255,249,255,247,255,246,255,223,255,234,255,235,255,1,0,237,255,237,255,239,255,239,255,252,255,221,255,13,0,3,0,252,255,0,0,2,0,1,0,3,0,14,0,240,255,12,0,2,0,249,255,242,255,8,0,12,0,240,255,249,255,253,255,240,255,251,255,239,255,233,255,245,255,14,0,252,255,255,255,1,0,254,255,0,0,5,0,252,255,238,255,254,255,249,255,235,255,240,255,251,255,242,255,11,0,255,255,237,255,237,255,251,255,246,255,238,255,253,255,9,0,250,255,251,255,4,0,6,0,0,0,244,255,252,255,250,255,12,0,2,0,8,0,253,255,247,255,252,255,1,0,253,255,250,255,0,0,237,255,236,255,246,255,252,255,10,0,2,0,15,0,4,0,250,255,252,255,254,255,254,255,254,255,8,0,17,0,0,0,5,0,0,0,245,255,10,0,1,0,248,255,251,255,254,255,254,255,6,0,13,0,254,255,2,0,5,0,3,0,1,0,4,0,4,0,16,0,3,0,22,0,15,0,10,0,4,0,253,255,7,0,11,0,8,0,8,0,2,0,240,255,19,0,251,255,253,255,23,0,5,0,12,0,15,0,4,0,19,0,3,0,255,255,11,0,23,0,18,0,251,255,3,0,5,0,244,255,12,0,1,0,10,0,3,0,6,0,9,0,251,255,19,0,13,0,18,0,4,0,15,0,19,0,4,0,6,0,254,255,3,0,241,255,4,0,254,255,255,255,252,255,0,0,243,255,249,255,237,255,242,255,244,255,245,255,224,255,220,255,231,255,231,255,216,255,234,255,224,255,234,255,252,255,247,255,236,255,242,255,237,255,251,255,246,255,245,255,0,0,2,0,246,255,242,255,7,0,9,0,251,255,239,255,247,255,243,255,248,255,246,255,245,255,231,255,240,255,3,0,237,255,252,255,243,255,244,255,231,255,241,255,242,255,248,255,238,255,248,255,247,255,246,255,7,0,255,255,254,255,9,0,10,0,21,0,15,0,20,0,16,0,6,0,19,0,0,0,23,0,12,0,6,0,12,0,8,0,13,0,17,0,15,0,12,0,1,0,35,0,31,0,18,0,37,0,2,0,14,0,9,0,8,0,14,0,12,0,253,255,2,0,24,0,14,0,14,0,10,0,6,0,240,255,1,0,255,255,4,0,2,0,254,255,252,255,252,255,5,0,3,0,248,255,251,255,244,255,247,255,248,255,241,255,9,0,16,0,26,0,4,0,248,255,245,255,9,0,9,0,0,0,9,0,255,255,5,0,9,0,252,255,243,255,234,255,251,255,255,255,19,0,246,255,241,255,255,255,8,0,17,0,253,255,255,255,5,0,5,0,251,255,30,0,7,0,155,0,121,255,29,255,88,0,59,0,226,255,229,255,46,0,26,0,211,255,12,0,62,0,97,255,210,255,46,0,11,0,238,255,6,0,15,0,7,0,10,0,225,255,251,255,15,0,44,0,227,255,21,0,35,0,33,0,6,0,12,0,35,0,98,0,246,255,92,255,92,0,59,0,41,0,6,0,238,255,45,0,161,255,237,255,49,0,32,0,27,0,21,0,235,255,229,255,33,0,46,0,223,255,245,255,237,255,245,255,4,0,230,255,238,255,11,0,241,255,221,255,212,255,234,255,15,0,17,0,27,0,0,0,228,255,212,255,30,0,19,0,29,0,19,0,13,0,55,0,24,0,3,0,10,0,4,0,253,255,1,0,255,255,15,0,30,0,184,255,186,255,250,255,3,0,34,0,10,0,226,255,251,255,33,0,243,255,242,255,39,0,39,0,243,255,7,0,39,0,2,0,255,255,19,0,253,255,6,0,29,0,26,0,70,0,14,0,211,255,210,255,55,0,48,0,224,255,191,255,223,255,8,0,225,255,201,255,229,255,0,0,213,255,208,255,210,255,251,255,254,255,229,255,201,255,179,255,3,0,17,0,217,255,247,255,3,0,228,255,239,255,226,255,225,255,19,0,23,0,244,255,232,255,4,0,223,255,186,255,209,255,244,255,33,0,23,0,32,0,41,0,30,0,2,0,33,0,50,0,41,0,31,0,20,0,15,0,39,0,62,0,13,0,25,0,43,0,50,0,46,0,8,0,252,255,248,255,254,255,220,255,206,255,250,255,254,255,248,255,237,255,203,255,225,255,239,255,27,0,5,0,230,255,193,255,213,255,253,255,4,0,16,0,33,0,42,0,31,0,225,255,180,255,229,255,1,0,248,255,10,0,236,255,200,255,228,255,240,255,14,0,13,0,254,255,253,255,219,255,249,255,229,255,206,255,189,255,165,255,204,255,226,255,248,255,185,255,181,255,214,255,207,255,194,255,182,255,156,255,153,255,212,255,231,255,245,255,222,255,229,255,215,255,206,255,209,255,238,255,15,0,28,0,40,0,42,0,55,0,54,0,23,0,22,0,38,0,35,0,61,0,35,0,243,255,242,255,250,255,22,0,6,0,248,255,15,0,49,0,112,0,96,0,25,0,251,255,34,0,57,0,57,0,25,0,8,0,3,0,248,255,248,255,192,255,189,255,190,255,214,255,2,0,52,0,67,0,60,0,62,0,62,0,56,0,89,0,106,0,97,0,42,0,24,0,29,0,52,0,26,0,246,255,4,0,77,0,135,0,77,0,249,255,250,255,14,0,232,255,239,255,20,0,30,0,49,0,48,0,3,0,227,255,251,255,227,255,232,255,241,255,161,255,196,255,10,0,39,0,40,0,54,0,116,0,114,0,59,0,3,0,54,0,44,0,218,255,169,255,181,255,252,255,57,0,254,255,171,255,131,255,165,255,239,255,34,0,234,255,146,255,119,255,150,255,196,255,255,255,73,0,57,0,21,0,216,255,199,255,22,0,44,0,21,0,239,255,175,255,242,255,77,0,69,0,234,255,242,255,71,0,125,0,96,0,28,0,75,0,63,0,9,0,246,255,49,0,19,0,216,255,28,0,88,0,102,0,12,0,204,255,22,0,72,0,47,0,233,255,240,255,20,0,209,255,142,255,224,255,44,0,64,0,44,0,252,255,228,255,0,0,183,255,127,255,216,255,233,255,144,255,77,255,161,255,242,255,237,255,205,255,200,255,239,255,251,255,184,255,154,255,153,255,110,255,81,255,145,255,0,0,230,255,139,255,190,255,63,0,56,0,21,0,34,0,235,255,208,255,16,0,13,0,3,0,21,0,228,255,230,255,71,0,108,0,218,255,87,255,72,255,157,255,45,0,140,0,86,0,224,255,195,255,2,0,49,0,46,0,33,0,234,255,249,255,159,0,196,0,14,0,233,255,60,0,87,0,31,0,10,0,215,255,212,255,3,0,218,255,2,0,104,0,108,0,2,0,192,255,139,255,76,255,148,255,234,255,210,255,123,255,138,255,227,255,29,0,69,0,79,0,65,0,255,255,9,0,202,255,112,255,146,255,44,0,118,0,73,0,48,0,66,0,145,0,135,0,252,255,229,255,111,0,201,0,227,0,167,0,74,0,29,0,171,0,236,0,87,0,254,255,63,0,141,0,169,0,175,0,99,0,14,0,245,255,248,255,90,0,112,0,33,0,117,0,181,0,133,0,38,0,105,0,200,0,226,0,102,0,208,255,200,255,210,255,201,255,204,255,116,255,56,255,17,0,176,0,62,0,120,255,94,255,211,255,157,0,23,1,223,0,169,0,13,0,131,255,130,255,165,254,95,253,212,254,62,1,160,1,79,1,86,1,53,1,151,0,128,255,39,255,143,0,119,1,247,255,127,254,187,254,241,254,226,254,78,255,110,0,71,1,192,0,244,254,116,253,121,253,202,254,100,255,219,254,240,254,72,255,28,254,34,253,20,254,228,254,243,254,169,255,149,255,240,253,169,253,49,255,9,0,139,255,57,255,145,255,235,255,107,255,155,252,27,250,245,250,189,251,130,250,200,250,46,251,77,249,42,250,28,255,176,0,193,253,100,252,8,252,226,249,77,247,31,245,158,243,115,243,56,244,242,243,56,241,109,238,135,237,240,238,3,242,27,246,212,251,160,2,143,7,66,13,107,35,200,78,140,113,67,114,223,95,176,80,233,69,63,57,70,41,137,26,109,19,37,15,222,3,61,244,30,232,142,220,48,206,158,194,56,189,170,186,157,183,236,180,89,181,67,187,23,198,19,207,35,211,105,216,255,222,192,226,204,231,225,239,74,249,202,7,65,28,102,40,81,39,18,41,34,51,127,59,210,59,222,56,226,55,111,54,156,49,197,44,82,46,221,50,154,44,103,27,194,14,185,9,253,0,94,243,218,231,105,223,238,215,97,209,249,202,22,198,21,198,19,201,141,202,133,201,146,201,199,204,144,211,179,219,231,223,6,224,182,227,158,237,149,246,75,251,97,0,211,7,234,15,211,23,21,30,72,36,41,44,191,48,164,46,7,44,26,43,136,39,60,34,77,30,63,27,92,24,186,21,213,17,146,12,115,7,51,3,10,0,26,254,159,252,157,250,46,247,119,243,243,240,28,239,58,238,9,238,195,236,6,235,219,232,209,229,241,227,234,228,95,230,29,231,214,233,172,238,158,243,128,249,249,0,35,8,69,14,126,19,198,23,187,27,1,33,16,39,24,43,16,44,76,42,105,39,28,37,140,34,234,30,191,26,47,22,242,15,229,8,42,3,73,254,218,248,37,243,9,238,191,233,135,229,132,225,87,222,63,219,103,216,45,215,240,214,254,214,117,216,160,219,40,224,21,229,85,233,44,237,149,241,191,246,194,252,229,3,89,10,97,14,78,17,121,20,55,23,167,25,147,27,126,28,114,28,130,27,201,25,227,23,143,21,151,18,96,15,6,12,142,8,197,4,41,0,171,250,152,245,96,241,246,237,45,235,204,232,170,230,52,229,161,228,106,229,12,232,92,235,13,238,202,240,154,243,206,245,115,248,190,252,190,1,131,5,230,7,100,10,73,13,212,14,42,14,68,13,141,13,166,14,92,15,126,15,141,15,19,16,228,16,154,17,28,18,50,18,161,17,237,16,136,16,69,16,150,15,73,14,89,12,168,10,132,9,109,8,207,6,74,4,142,0,114,252,27,249,82,246,130,243,120,240,7,238,86,236,129,234,33,232,30,230,211,228,248,227,159,227,109,228,22,230,110,232,187,235,221,239,41,245,80,251,88,1,250,5,81,9,125,11,180,13,93,16,176,18,211,19,145,20,142,21,40,22,115,22,237,21,74,20,85,17,216,13,89,10,53,7,37,4,31,1,154,254,16,253,173,252,101,252,34,251,252,248,61,246,15,243,25,240,224,237,36,236,124,234,62,233,5,233,128,234,57,237,77,239,253,239,218,240,183,242,250,244,169,247,170,250,112,253,173,255,203,1,97,4,182,6,65,8,107,9,186,10,61,12,113,13,74,13,34,12,2,11,80,10,211,10,213,12,83,15,167,16,154,16,156,16,109,17,215,18,8,20,213,19,129,18,234,16,1,15,226,12,244,10,206,8,165,5,95,2,240,255,193,253,170,250,134,246,47,242,88,238,251,234,186,231,21,229,28,228,245,228,54,231,226,233,45,236,78,237,227,237,161,239,218,242,222,246,157,251,167,0,186,4,243,7,193,11,147,16,115,20,88,22,75,23,53,25,96,27,20,28,23,27,91,25,133,23,249,20,36,17,84,12,238,7,81,4,112,0,77,251,233,245,127,241,252,237,27,234,160,230,251,228,228,228,79,229,14,230,92,231,133,232,71,233,119,234,48,237,143,240,204,241,59,241,237,241,129,244,20,247,250,248,143,251,146,255,68,4,238,7,51,10,111,12,189,14,243,15,106,16,168,17,39,20,180,22,45,23,238,21,183,20,77,20,202,19,175,18,193,16,57,14,50,11,45,8,241,5,250,3,229,1,158,255,171,253,216,251,82,249,241,246,248,244,196,242,199,239,205,236,227,234,225,233,115,233,77,233,175,233,106,235,71,238,147,241,11,245,82,248,137,251,237,254,245,2,90,7,164,11,177,15,23,19,224,21,86,24,40,26,86,27,250,27,247,27,165,27,163,26,106,24,202,20,117,16,186,12,6,10,105,7,2,4,38,0,99,252,147,248,247,244,2,242,13,239,32,236,116,233,150,231,143,230,173,229,223,228,217,228,231,229,141,231,185,233,141,236,44,240,204,243,50,247,110,250,231,253,60,1,32,4,235,6,157,9,49,12,168,14,171,16,63,18,141,19,75,20,108,20,95,19,13,17,86,14,3,12,235,9,62,7,25,4,153,1,168,255,94,253,178,250,38,248,44,246,148,244,51,243,36,242,125,241,54,241,63,241,153,241,124,242,138,243,144,244,134,245,165,246,27,248,215,249,202,251,145,253,210,254,239,255,58,1,28,3,3,5,179,6,33,8,54,9,254,9,66,10,87,10,222,10,155,11,202,11,143,11,69,11,132,11,40,12,194,12,134,12,174,11,184,10,216,9,28,9,224,7,185,5,43,3,183,0,59,254,65,252,134,250,34,249,16,248,28,247,209,245,33,244,128,242,77,241,247,240,139,241,121,242,199,243,96,245,16,247,24,249,99,251,226,253,255,255,119,1,142,2,252,3,217,5,213,7,195,9,30,11,0,12,226,12,252,13,128,14,89,14,18,14,169,13,239,12,156,11,125,9,64,7,107,5,22,4,215,2,156,1,230,255,123,253,135,250,117,247,240,244,29,243,135,241,228,239,41,238,175,236,219,235,174,235,104,236,208,237,105,239,69,241,81,243,89,245,253,246,255,248,142,251,27,254,167,0,6,3,84,5,178,7,198,9,22,11,103,11,79,11,109,11,34,12,36,13,194,13,162,13,250,12,92,12,161,11,150,10,92,9,81,8,243,6,172,4,218,1,43,255,57,253,179,251,168,249,138,247,198,245,158,244,203,243,21,243,190,242,95,242,72,242,163,242,141,243,57,245,84,247,68,249,3,251,239,252,91,255,245,1,74,4,49,6,140,7,193,8,142,9,94,10,193,11,121,13,219,14,239,15,227,16,158,17,194,17,26,17,14,16,254,14,225,13,106,12,160,10,189,8,76,6,99,3,58,0,97,253,8,251,3,249,252,246,248,244,191,242,129,240,58,239,194,238,216,238,41,239,71,239,95,239,247,239,9,241,93,242,219,243,56,245,149,246,87,248,52,250,25,252,7,254,13,0,21,2,12,4,43,6,68,8,231,9,43,11,47,12,171,12,239,12,225,12,106,12,184,11,163,10,72,9,205,7,67,6,153,4,228,2,97,1,33,0,219,254,184,253,188,252,4,252,79,251,139,250,228,249,59,249,133,248,156,247,126,246,198,245,67,245,0,245,225,244,50,245,178,245,255,245,149,246,16,248,0,250,160,251,73,253,60,255,57,1,231,2,93,4,212,5,149,7,93,9,143,10,158,11,122,12,224,12,245,12,50,13,87,13,206,12,185,11,155,10,174,9,201,8,180,7,50,6,105,4,132,2,177,0,33,255,47,254,119,253,105,252,0,251,152,249,166,248,252,247,134,247,28,247,194,246,99,246,46,246,37,246,102,246,1,247,17,248,169,249,86,251,132,252,79,253,210,254,253,0,229,2,48,4,100,5,145,6,167,7,163,8,88,9,9,10,111,10,107,10,83,10,61,10,46,10,187,9,43,9,35,8,125,6,106,4,135,2,25,1,61,255,210,252,99,250,102,248,184,246,16,245,139,243,235,242,31,243,75,243,53,243,135,243,102,244,61,245,208,245,149,246,204,247,80,249,110,250,46,251,52,252,170,253,239,254,14,0,97,1,175,2,250,3,233,4,246,5,82,7,100,8,247,8,112,9,251,9,155,10,217,10,157,10,110,10,46,10,121,9,37,8,189,6,52,5,150,3,187,1,218,255,97,254,43,253,31,252,5,251,250,249,21,249,35,248,123,247,30,247,236,246,226,246,229,246,223,246,63,247,230,247,223,248,28,250,149,251,90,253,224,254,27,0,61,1,137,2,244,3,108,5,221,6,8,8,30,9,18,10,245,10,118,11,78,11,181,10,221,9,79,9,198,8,103,8,208,7,6,7,228,5,96,4,118,2,137,0,240,254,186,253,60,252,114,250,128,248,152,246,62,245,70,244,243,243,185,243,199,243,25,244,86,244,185,244,37,245,220,245,231,246,16,248,124,249,12,251,12,253,6,255,185,0,76,2,245,3,121,5,205,6,7,8,240,8,127,9,169,9,177,9,213,9,218,9,205,9,131,9,55,9,206,8,207,7,127,6,22,5,213,3,88,2,144,0,201,254,121,253,104,252,16,251,184,249,199,248,26,248,150,247,9,247,133,246,254,245,167,245,175,245,61,246,52,247,23,248,253,248,37,250,168,251,24,253,165,254,37,0,163,1,235,2,80,4,169,5,16,7,81,8,64,9,39,10,234,10,165,11,255,11,42,12,245,11,168,11,34,11,122,10,107,9,35,8,176,6,34,5,161,3,234,1,237,255,180,253,190,251,244,249,81,248,93,246,146,244,89,243,176,242,90,242,39,242,34,242,80,242,220,242,159,243,217,244,95,246,230,247,142,249,134,251,146,253,156,255,235,1,3,4,241,5,203,7,52,9,84,10,82,11,89,12,242,12,35,13,213,12,75,12,149,11,137,10,108,9,62,8,183,6,237,4,51,3,167,1,45,0,180,254,52,253,170,251,239,249,98,248,65,247,140,246,244,245,81,245,207,244,105,244,113,244,224,244,195,245,171,246,135,247,69,248,22,249,35,250,181,251,145,253,114,255,56,1,223,2,108,4,248,5,92,7,179,8,4,10,208,10,34,11,123,11,224,11,243,11,124,11,195,10,1,10,247,8,176,7,104,6,39,5,203,3,87,2,190,0,20,255,161,253,71,252,232,250,178,249,170,248,242,247,99,247,234,246,100,246,20,246,15,246,10,246,31,246,168,246,115,247,119,248,120,249,119,250,150,251,231,252,91,254,220,255,91,1,178,2,220,3,3,5,248,5,1,7,0,8,210,8,129,9,29,10,83,10,94,10,43,10,170,9,239,8,244,7,195,6,61,5,198,3,15,2,144,0,29,255,131,253,201,251,9,250,153,248,103,247,123,246,245,245,176,245,176,245,211,245,31,246,209,246,217,247,241,248,243,249,6,251,60,252,139,253,255,254,24,0,232,0,162,1,114,2,107,3,81,4,24,5,155,5,254,5,31,6,61,6,109,6,151,6,161,6,178,6,145,6,62,6,251,5,166,5,55,5,116,4,126,3,109,2,74,1,5,0,215,254,189,253,181,252,223,251,20,251,119,250,253,249,120,249,21,249,226,248,231,248,0,249,82,249,180,249,53,250,242,250,186,251,136,252,63,253,1,254,158,254,88,255,68,0,14,1,158,1,37,2,194,2,115,3,34,4,189,4,78,5,188,5,17,6,121,6,192,6,190,6,170,6,95,6,242,5,176,5,86,5,194,4,22,4,251,2,238,1,234,0,222,255,178,254,72,253,45,252,31,251,37,250,69,249,186,248,72,248,231,247,177,247,220,247,118,248,36,249,247,249,172,250,170,251,249,252,62,254,94,255,104,0,96,1,61,2,9,3,141,3,246,3,162,4,16,5,75,5,157,5,216,5,14,6,8,6,249,5,235,5,201,5,154,5,32,5,120,4,161,3,11,3,113,2,180,1,237,0,60,0,101,255,142,254,241,253,99,253,172,252,227,251,14,251,103,250,212,249,125,249,62,249,42,249,66,249,105,249,203,249,90,250,58,251,18,252,223,252,155,253,98,254,77,255,62,0,0,1,193,1,167,2,72,3,173,3,47,4,248,4,183,5,0,6,21,6,21,6,3,6,173,5,106,5,66,5,240,4,120,4,200,3,10,3,115,2,163,1,184,0,210,255,217,254,172,253,109,252,94,251,147,250,236,249,96,249,198,248,106,248,87,248,67,248,60,248,68,248,174,248,87,249,255,249,188,250,181,251,192,252,239,253,47,255,122,0,215,1,26,3,59,4,25,5,250,5,223,6,175,7,70,8,185,8,252,8,24,9,224,8,87,8,186,7,232,6,236,5,186,4,149,3,98,2,59,1,10,0,28,255,16,254,21,253,47,252,129,251,24,251,162,250,70,250,213,249,132,249,121,249,125,249,164,249,244,249,121,250,26,251,174,251,125,252,69,253,18,254,33,255,43,0,64,1,74,2,67,3,23,4,225,4,158,5,67,6,223,6,93,7,171,7,171,7,70,7,171,6,241,5,24,5,17,4,3,3,26,2,80,1,114,0,81,255,86,254,145,253,235,252,43,252,138,251,205,250,29,250,139,249,40,249,233,248,6,249,23,249,29,249,71,249,136,249,7,250,109,250,229,250,68,251,219,251,182,252,216,253,224,254,15,0,38,1,90,2,129,3,93,4,66,5,203,5,110,6,221,6,43,7,108,7,111,7,79,7,2,7,172,6,47,6,132,5,193,4,187,3,105,2,80,1,82,0,68,255,64,254,68,253,134,252,238,251,126,251,244,250,168,250,151,250,138,250,138,250,157,250,205,250,16,251,108,251,193,251,66,252,215,252,125,253,23,254,189,254,89,255,26,0,224,0,169,1,99,2,232,2,115,3,24,4,153,4,11,5,72,5,137,5,182,5,184,5,152,5,84,5,245,4,154,4,24,4,100,3,175,2,251,1,67,1,135,0,246,255,101,255,225,254,113,254,236,253,107,253,242,252,143,252,65,252,243,251,169,251,112,251,83,251,106,251,117,251,143,251,153,251,194,251,247,251,92,252,193,252,43,253,171,253,13,254,120,254,253,254,186,255,98,0,215,0,59,1,154,1,243,1,64,2,182,2,10,3,76,3,90,3,116,3,162,3,196,3,206,3,154,3,97,3,8,3,139,2,7,2,121,1,221,0,42,0,141,255,237,254,113,254,235,253,133,253,45,253,248,252,175,252,182,252,178,252,198,252,255,252,6,253,33,253,95,253,217,253,141,254,44,255,196,255,61,0,178,0,35,1,107,1,183,1,40,2,156,2,211,2,19,3,82,3,116,3,131,3,171,3,225,3,11,4,17,4,254,3,230,3,171,3,91,3,249,2,119,2,40,2,159,1,227,0,66,0,150,255,236,254,58,254,139,253,239,252,111,252,240,251,132,251,40,251,213,250,182,250,174,250,232,250,45,251,125,251,210,251,68,252,192,252,50,253,201,253,114,254,43,255,163,255,84,0,207,0,96,1,224,1,53,2,127,2,237,2,52,3,95,3,101,3,67,3,12,3,212,2,218,2,154,2,101,2,24,2,165,1,60,1,186,0,112,0,243,255,143,255,28,255,181,254,67,254,211,253,138,253,67,253,8,253,199,252,194,252,233,252,47,253,90,253,141,253,11,254,130,254,249,254,126,255,239,255,75,0,192,0,26,1,99,1,212,1,43,2,112,2,185,2,245,2,42,3,64,3,83,3,82,3,76,3,62,3,51,3,12,3,213,2,146,2,50,2,252,1,185,1,92,1,222,0,84,0,246,255,181,255,103,255,242,254,130,254,35,254,218,253,188,253,106,253,58,253,13,253,35,253,46,253,66,253,95,253,138,253,181,253,195,253,29,254,120,254,240,254,66,255,139,255,255,255,78,0,155,0,208,0,15,1,38,1,49,1,66,1,50,1,243,0,216,0,167,0,132,0,103,0,8,0,225,255,136,255,42,255,229,254,173,254,155,254,149,254,197,254,241,254,36,255,71,255,126,255,208,255,43,0,92,0,152,0,225,0,241,0,21,1,11,1,16,1,47,1,41,1,28,1,14,1,11,1,0,1,240,0,232,0,209,0,171,0,145,0,117,0,95,0,88,0,73,0,53,0,68,0,71,0,93,0,124,0,128,0,118,0,93,0,95,0,86,0,90,0,76,0,54,0,55,0,100,0,152,0,171,0,143,0,144,0,117,0,73,0,12,0,186,255,110,255,79,255,68,255,37,255,15,255,0,255,233,254,175,254,152,254,119,254,72,254,83,254,69,254,44,254,79,254,118,254,168,254,209,254,236,254,27,255,62,255,110,255,140,255,203,255,248,255,13,0,63,0,99,0,144,0,174,0,203,0,220,0,245,0,251,0,242,0,233,0,197,0,157,0,94,0,74,0,58,0,73,0,61,0,47,0,65,0,96,0,131,0,116,0,138,0,140,0,156,0,150,0,161,0,151,0,146,0,148,0,114,0,104,0,76,0,53,0,34,0,20,0,12,0,233,255,185,255,159,255,107,255,115,255,130,255,114,255,107,255,108,255,127,255,105,255,109,255,118,255,156,255,144,255,147,255,170,255,163,255,195,255,240,255,15,0,18,0,45,0,74,0,144,0,181,0,207,0,232,0,236,0,250,0,200,0,195,0,186,0,197,0,176,0,143,0,105,0,54,0,79,0,241,255,153,255,109,255,42,255,15,255,238,254,238,254,217,254,223,254,214,254,203,254,201,254,188,254,202,254,204,254,227,254,221,254,195,254,214,254,253,254,43,255,98,255,149,255,177,255,219,255,17,0,65,0,114,0,170,0,210,0,3,1,45,1,104,1,147,1,182,1,205,1,220,1,210,1,222,1,222,1,193,1,193,1,158,1,109,1,51,1,245,0,145,0,82,0,19,0,205,255,103,255,18,255,219,254,154,254,122,254,82,254,66,254,58,254,57,254,54,254,91,254,103,254,136,254,159,254,184,254,241,254,35,255,91,255,140,255,170,255,230,255,18,0,80,0,102,0,121,0,152,0,154,0,175,0,227,0,38,1,51,1,69,1,91,1,113,1,108,1,115,1,121,1,75,1,38,1,16,1,250,0,17,1,239,0,211,0,146,0,86,0,25,0,218,255,179,255,78,255,5,255,184,254,119,254,77,254,43,254,23,254,228,253,239,253,231,253,20,254,44,254,62,254,78,254,127,254,184,254,231,254,46,255,107,255,195,255,4,0,72,0,145,0,209,0,23,1,102,1,168,1,229,1,29,2,110,2,155,2,189,2,214,2,238,2,220,2,202,2,161,2,122,2,48,2,214,1,138,1,27,1,177,0,56,0,197,255,57,255,179,254,72,254,203,253,105,253,24,253,219,252,150,252,124,252,102,252,106,252,130,252,154,252,204,252,14,253,128,253,1,254,121,254,250,254,97,255,245,255,135,0,251,0,122,1,203,1,81,2,166,2,239,2,51,3,86,3,105,3,108,3,90,3,27,3,228,2,132,2,36,2,195,1,95,1,242,0,140,0,42,0,186,255,81,255,244,254,148,254,56,254,234,253,151,253,87,253,52,253,16,253,9,253,9,253,31,253,80,253,141,253,222,253,79,254,156,254,23,255,147,255,3,0,109,0,9,1,137,1,250,1,90,2,173,2,22,3,75,3,110,3,117,3,107,3,72,3,16,3,197,2,118,2,13,2,182,1,83,1,217,0,130,0,23,0,152,255,39,255,183,254,72,254,236,253,157,253,104,253,37,253,11,253,224,252,222,252,215,252,216,252,253,252,35,253,100,253,159,253,252,253,63,254,192,254,34,255,150,255,45,0,193,0,71,1,215,1,76,2,176,2,9,3,98,3,172,3,230,3,6,4,9,4,248,3,164,3,70,3,232,2,126,2,249,1,107,1,210,0,44,0,123,255,216,254,79,254,199,253,94,253,8,253,211,252,166,252,146,252,149,252,175,252,193,252,232,252,31,253,108,253,192,253,20,254,128,254,211,254,74,255,175,255,40,0,166,0,17,1,155,1,239,1,37,2,93,2,126,2,169,2,191,2,201,2,192,2,197,2,151,2,102,2,48,2,230,1,158,1,55,1,193,0,52,0,212,255,95,255,210,254,140,254,53,254,218,253,150,253,93,253,76,253,31,253,31,253,43,253,37,253,72,253,108,253,162,253,245,253,84,254,174,254,30,255,130,255,217,255,32,0,110,0,195,0,30,1,88,1,148,1,225,1,20,2,75,2,126,2,160,2,184,2,176,2,161,2,135,2,79,2,25,2,221,1,119,1,18,1,187,0,87,0,250,255,145,255,9,255,171,254,71,254,235,253,150,253,84,253,35,253,19,253,251,252,31,253,52,253,81,253,124,253,192,253,14,254,84,254,179,254,16,255,127,255,229,255,78,0,202,0,49,1,127,1,228,1,61,2,142,2,193,2,229,2,244,2,0,3,249,2,219,2,190,2,142,2,83,2,254,1,145,1,43,1,197,0,78,0,203,255,51,255,211,254,86,254,9,254,192,253,135,253,97,253,31,253,250,252,205,252,168,252,177,252,200,252,242,252,39,253,110,253,185,253,29,254,135,254,252,254,121,255,15,0,140,0,12,1,147,1,242,1,107,2,183,2,29,3,116,3,191,3,8,4,37,4,27,4,36,4,30,4,203,3,137,3,17,3,145,2,18,2,133,1,245,0,48,0,132,255,226,254,87,254,222,253,48,253,211,252,106,252,3,252,219,251,183,251,182,251,205,251,244,251,43,252,164,252,253,252,137,253,31,254,179,254,94,255,227,255,142,0,26,1,185,1,75,2,176,2,20,3,129,3,176,3,224,3,250,3,251,3,232,3,192,3,141,3,47,3,209,2,71,2,188,1,60,1,162,0,38,0,141,255,22,255,156,254,32,254,159,253,60,253,239,252,181,252,135,252,95,252,62,252,78,252,101,252,142,252,219,252,43,253,118,253,218,253,66,254,191,254,44,255,159,255,20,0,140,0,14,1,124,1,246,1,89,2,194,2,252,2,36,3,90,3,138,3,164,3,152,3,129,3,97,3,37,3,200,2,103,2,27,2,168,1,49,1,178,0,50,0,185,255,63,255,199,254,99,254,13,254,177,253,85,253,51,253,251,252,250,252,251,252,15,253,62,253,125,253,205,253,31,254,143,254,235,254,61,255,174,255,18,0,150,0,239,0,79,1,209,1,8,2,101,2,158,2,217,2,249,2,8,3,251,2,218,2,166,2,80,2,252,1,140,1,55,1,174,0,61,0,180,255,72,255,183,254,19,254,217,253,114,253,53,253,252,252,192,252,178,252,154,252,204,252,245,252,52,253,120,253,206,253,67,254,171,254,21,255,120,255,244,255,95,0,212,0,62,1,165,1,221,1,40,2,70,2,119,2,137,2,150,2,150,2,111,2,75,2,3,2,204,1,123,1,22,1,194,0,105,0,6,0,187,255,102,255,33,255,212,254,145,254,84,254,36,254,5,254,237,253,227,253,226,253,242,253,20,254,68,254,103,254,165,254,218,254,47,255,95,255,192,255,8,0,80,0,157,0,250,0,86,1,142,1,202,1,1,2,45,2,68,2,86,2,91,2,67,2,41,2,255,1,163,1,96,1,38,1,178,0,95,0,3,0,159,255,58,255,230,254,145,254,53,254,1,254,189,253,123,253,122,253,103,253,108,253,105,253,153,253,222,253,17,254,75,254,138,254,202,254,25,255,96,255,178,255,246,255,71,0,144,0,216,0,31,1,103,1,171,1,200,1,212,1,242,1,241,1,234,1,245,1,220,1,177,1,139,1,91,1,54,1,236,0,174,0,116,0,47,0,221,255,132,255,56,255,239,254,209,254,166,254,135,254,102,254,100,254,101,254,97,254,141,254,165,254,188,254,240,254,45,255,90,255,153,255,214,255,12,0,94,0,149,0,213,0,245,0,37,1,63,1,76,1,115,1,115,1,108,1,100,1,85,1,80,1,37,1,25,1,242,0,204,0,170,0,118,0,46,0,26,0,215,255,146,255,106,255,67,255,30,255,5,255,239,254,186,254,197,254,171,254,206,254,206,254,234,254,242,254,11,255,58,255,80,255,165,255,195,255,10,0,58,0,130,0,161,0,213,0,245,0,34,1,60,1,95,1,132,1,129,1,130,1,112,1,121,1,95,1,68,1,20,1,235,0,177,0,107,0,60,0,251,255,148,255,100,255,36,255,226,254,169,254,117,254,66,254,35,254,242,253,233,253,246,253,251,253,31,254,70,254,130,254,190,254,12,255,96,255,188,255,34,0,112,0,203,0,44,1,119,1,198,1,17,2,82,2,122,2,123,2,178,2,146,2,125,2,87,2,33,2,221,1,125,1,34,1,172,0,69,0,217,255,94,255,226,254,124,254,51,254,203,253,133,253,69,253,17,253,250,252,225,252,250,252,23,253,80,253,142,253,231,253,80,254,193,254,59,255,177,255,45,0,173,0,38,1,154,1,254,1,68,2,153,2,225,2,8,3,29,3,29,3,17,3,236,2,192,2,116,2,24,2,189,1,93,1,207,0,83,0,216,255,77,255,219,254,97,254,236,253,109,253,32,253,200,252,142,252,110,252,90,252,92,252,117,252,176,252,251,252,74,253,195,253,46,254,200,254,70,255,222,255,114,0,251,0,122,1,244,1,89,2,162,2,231,2,44,3,80,3,90,3,89,3,47,3,21,3,210,2,145,2,44,2,225,1,104,1,228,0,130,0,254,255,161,255,27,255,180,254,83,254,237,253,146,253,91,253,35,253,18,253,238,252,5,253,27,253,63,253,153,253,245,253,91,254,188,254,74,255,198,255,58,0,182,0,61,1,176,1,38,2,120,2,206,2,7,3,64,3,100,3,120,3,104,3,67,3,13,3,187,2,108,2,235,1,151,1,19,1,143,0,22,0,165,255,52,255,176,254,81,254,244,253,167,253,88,253,48,253,11,253,223,252,231,252,1,253,42,253,82,253,171,253,255,253,100,254,204,254,61,255,171,255,34,0,177,0,24,1,144,1,254,1,89,2,169,2,226,2,18,3,21,3,34,3,31,3,232,2,176,2,101,2,2,2,144,1,35,1,149,0,4,0,112,255,244,254,108,254,225,253,99,253,240,252,183,252,89,252,40,252,23,252,21,252,54,252,103,252,184,252,17,253,134,253,5,254,168,254,64,255,217,255,147,0,61,1,225,1,129,2,23,3,141,3,239,3,53,4,121,4,157,4,150,4,114,4,57,4,231,3,115,3,213,2,56,2,129,1,219,0,30,0,90,255,162,254,225,253,63,253,172,252,65,252,212,251,138,251,70,251,42,251,65,251,96,251,178,251,24,252,131,252,17,253,168,253,74,254,250,254,165,255,128,0,55,1,212,1,125,2,18,3,161,3,6,4,97,4,128,4,168,4,149,4,127,4,80,4,247,3,154,3,14,3,113,2,209,1,35,1,103,0,173,255,232,254,56,254,160,253,1,253,132,252,249,251,176,251,120,251,86,251,73,251,66,251,119,251,199,251,18,252,143,252,18,253,154,253,81,254,252,254,186,255,112,0,44,1,213,1,120,2,10,3,139,3,218,3,62,4,112,4,132,4,139,4,122,4,85,4,7,4,179,3,71,3,199,2,61,2,146,1,223,0,57,0,117,255,223,254,52,254,142,253,19,253,165,252,72,252,3,252,224,251,176,251,208,251,247,251,49,252,153,252,248,252,130,253,28,254,200,254,113,255,34,0,215,0,99,1,2,2,139,2,246,2,95,3,161,3,199,3,225,3,208,3,182,3,115,3,35,3,197,2,74,2,194,1,52,1,161,0,246,255,96,255,206,254,68,254,201,253,101,253,13,253,221,252,166,252,132,252,174,252,199,252,198,252,26,253,91,253,196,253,47,254,174,254,36,255,159,255,44,0,166,0,38,1,142,1,231,1,81,2,146,2,189,2,204,2,200,2,182,2,141,2,78,2,21,2,198,1,97,1,2,1,154,0,52,0,167,255,60,255,216,254,110,254,29,254,202,253,163,253,121,253,96,253,115,253,137,253,208,253,247,253,90,254,187,254,30,255,158,255,6,0,130,0,255,0,71,1,200,1,35,2,106,2,161,2,185,2,197,2,192,2,162,2,108,2,43,2,219,1,138,1,24,1,178,0,59,0,188,255,64,255,210,254,120,254,30,254,196,253,136,253,93,253,64,253,77,253,92,253,115,253,214,253,27,254,111,254,229,254,96,255,208,255,95,0,213,0,87,1,208,1,60,2,156,2,213,2,15,3,45,3,70,3,73,3,43,3,225,2,163,2,60,2,197,1,85,1,176,0,46,0,169,255,12,255,118,254,228,253,113,253,251,252,149,252,94,252,24,252,254,251,232,251,14,252,63,252,129,252,245,252,93,253,224,253,103,254,37,255,198,255,119,0,35,1,194,1,102,2,5,3,137,3,7,4,79,4,121,4,151,4,141,4,84,4,42,4,188,3,82,3,194,2,19,2,99,1,150,0,223,255,9,255,77,254,135,253,218,252,56,252,177,251,64,251,229,250,170,250,162,250,155,250,220,250,49,251,153,251,46,252,201,252,158,253,103,254,47,255,41,0,253,0,220,1,171,2,112,3,23,4,163,4,23,5,97,5,156,5,159,5,150,5,79,5,249,4,134,4,233,3,51,3,112,2,157,1,177,0,220,255,252,254,51,254,98,253,172,252,7,252,119,251,9,251,193,250,163,250,132,250,174,250,213,250,66,251,188,251,75,252,239,252,181,253,126,254,58,255,42,0,249,0,195,1,133,2,69,3,231,3,91,4,189,4,247,4,22,5,29,5,7,5,227,4,132,4,10,4,129,3,207,2,34,2,112,1,161,0,231,255,50,255,125,254,216,253,65,253,192,252,94,252,11,252,242,251,197,251,224,251,247,251,39,252,117,252,209,252,66,253,192,253,81,254,235,254,115,255,13,0,167,0,49,1,179,1,34,2,131,2,228,2,30,3,65,3,94,3,85,3,71,3,34,3,221,2,136,2,52,2,205,1,77,1,227,0,101,0,222,255,123,255,252,254,135,254,40,254,234,253,174,253,143,253,111,253,102,253,119,253,139,253,190,253,239,253,53,254,102,254,159,254,5,255,78,255,182,255,16,0,105,0,170,0,227,0,24,1,50,1,105,1,103,1,110,1,127,1,116,1,70,1,37,1,4,1,213,0,175,0,137,0,85,0,38,0,239,255,194,255,188,255,145,255,151,255,133,255,128,255,140,255,158,255,160,255,191,255,213,255,237,255,2,0,17,0,27,0,22,0,25,0,33,0,22,0,230,255,216,255,205,255,157,255,133,255,95,255,49,255,35,255,2,255,252,254,236,254,234,254,240,254,33,255,53,255,107,255,163,255,204,255,32,0,73,0,153,0,227,0,15,1,72,1,126,1,179,1,215,1,243,1,232,1,245,1,227,1,212,1,163,1,113,1,65,1,237,0,165,0,59,0,235,255,134,255,32,255,181,254,98,254,6,254,191,253,140,253,72,253,43,253,27,253,37,253,75,253,124,253,186,253,29,254,123,254,239,254,110,255,224,255,115,0,1,1,115,1,242,1,89,2,163,2,248,2,46,3,60,3,82,3,39,3,29,3,219,2,140,2,62,2,196,1,79,1,209,0,87,0,223,255,110,255,253,254,131,254,19,254,191,253,131,253,76,253,49,253,45,253,57,253,72,253,124,253,185,253,12,254,88,254,205,254,79,255,172,255,58,0,164,0,18,1,133,1,216,1,69,2,122,2,161,2,187,2,197,2,168,2,160,2,111,2,34,2,218,1,118,1,32,1,188,0,66,0,222,255,121,255,31,255,212,254,110,254,64,254,27,254,241,253,221,253,210,253,221,253,254,253,37,254,84,254,151,254,218,254,26,255,114,255,187,255,247,255,71,0,140,0,214,0,3,1,42,1,76,1,94,1,98,1,98,1,91,1,76,1,31,1,250,0,208,0,155,0,103,0,51,0,252,255,207,255,153,255,106,255,65,255,39,255,33,255,6,255,25,255,26,255,33,255,62,255,90,255,118,255,165,255,224,255,239,255,26,0,74,0,118,0,148,0,161,0,183,0,176,0,190,0,190,0,166,0,163,0,130,0,100,0,72,0,34,0,242,255,200,255,174,255,136,255,117,255,83,255,81,255,67,255,68,255,85,255,81,255,127,255,148,255,194,255,229,255,25,0,71,0,104,0,168,0,189,0,236,0,248,0,29,1,17,1,21,1,4,1,248,0,226,0,189,0,135,0,85,0,24,0,226,255,154,255,87,255,44,255,234,254,200,254,165,254,132,254,134,254,138,254,153,254,183,254,206,254,15,255,50,255,115,255,194,255,249,255,67,0,125,0,193,0,226,0,24,1,58,1,72,1,90,1,92,1,60,1,40,1,18,1,217,0,178,0,139,0,63,0,7,0,210,255,146,255,83,255,21,255,240,254,155,254,171,254,172,254,165,254,182,254,188,254,212,254,246,254,37,255,102,255,145,255,199,255,19,0,83,0,149,0,179,0,246,0,19,1,47,1,61,1,51,1,67,1,37,1,254,0,213,0,156,0,99,0,32,0,227,255,170,255,103,255,40,255,255,254,215,254,177,254,167,254,155,254,171,254,191,254,253,254,32,255,100,255,163,255,233,255,49,0,133,0,186,0,23,1,64,1,131,1,168,1,180,1,195,1,175,1,170,1,133,1,75,1,3,1,172,0,91,0,7,0,141,255,85,255,232,254,130,254,75,254,255,253,185,253,154,253,136,253,135,253,152,253,186,253,237,253,58,254,150,254,251,254,96,255,232,255,76,0,213,0,68,1,179,1,34,2,105,2,185,2,231,2,15,3,246,2,253,2,207,2,144,2,73,2,203,1,105,1,215,0,91,0,211,255,106,255,218,254,117,254,11,254,167,253,97,253,36,253,13,253,247,252,4,253,35,253,65,253,147,253,231,253,59,254,175,254,22,255,164,255,7,0,119,0,250,0,88,1,180,1,14,2,67,2,119,2,147,2,146,2,146,2,124,2,92,2,34,2,201,1,138,1,56,1,231,0,141,0,62,0,221,255,145,255,64,255,3,255,204,254,155,254,130,254,99,254,78,254,94,254,105,254,123,254,134,254,175,254,196,254,232,254,21,255,46,255,103,255,141,255,182,255,227,255,240,255,38,0,64,0,81,0,111,0,142,0,165,0,187,0,202,0,235,0,255,0,2,1,35,1,56,1,68,1,62,1,83,1,86,1,63,1,60,1,52,1,13,1,245,0,205,0,144,0,92,0,31,0,206,255,150,255,55,255,249,254,191,254,122,254,47,254,251,253,198,253,165,253,169,253,166,253,181,253,221,253,21,254,94,254,199,254,45,255,148,255,24,0,141,0,11,1,119,1,241,1,97,2,183,2,247,2,38,3,61,3,48,3,22,3,227,2,157,2,58,2,180,1,47,1,157,0,16,0,112,255,202,254,68,254,195,253,74,253,1,253,173,252,169,252,156,252,180,252,243,252,66,253,151,253,38,254,164,254,39,255,202,255,86,0,223,0,110,1,224,1,65,2,136,2,186,2,220,2,210,2,195,2,126,2,64,2,213,1,113,1,235,0,95,0,228,255,96,255,234,254,142,254,46,254,241,253,203,253,183,253,191,253,209,253,23,254,102,254,169,254,11,255,127,255,236,255,104,0,210,0,66,1,132,1,206,1,0,2,20,2,31,2,241,1,210,1,130,1,33,1,199,0,84,0,230,255,86,255,237,254,120,254,35,254,234,253,181,253,158,253,140,253,175,253,225,253,39,254,113,254,231,254,109,255,228,255,81,0,219,0,86,1,182,1,17,2,76,2,138,2,153,2,153,2,126,2,73,2,5,2,168,1,36,1,183,0,44,0,186,255,52,255,181,254,84,254,247,253,175,253,123,253,117,253,122,253,156,253,208,253,36,254,130,254,243,254,109,255,248,255,97,0,220,0,94,1,181,1,13,2,47,2,84,2,66,2,62,2,11,2,201,1,101,1,243,0,145,0,9,0,164,255,32,255,209,254,105,254,34,254,10,254,231,253,244,253,3,254,77,254,161,254,4,255,108,255,237,255,90,0,204,0,81,1,169,1,2,2,60,2,88,2,105,2,73,2,23,2,205,1,101,1,250,0,117,0,246,255,113,255,222,254,98,254,221,253,162,253,92,253,39,253,41,253,54,253,104,253,172,253,14,254,132,254,5,255,152,255,38,0,192,0,74,1,174,1,39,2,101,2,173,2,203,2,201,2,165,2,130,2,62,2,215,1,83,1,218,0,78,0,185,255,82,255,208,254,127,254,25,254,242,253,191,253,182,253,216,253,248,253,45,254,140,254,219,254,58,255,170,255,10,0,116,0,179,0,6,1,50,1,87,1,101,1,118,1,94,1,37,1,8,1,200,0,133,0,68,0,245,255,183,255,127,255,61,255,30,255,11,255,6,255,29,255,31,255,69,255,142,255,165,255,243,255,58,0,98,0,176,0,239,0,25,1,59,1,86,1,75,1,106,1,78,1,38,1,238,0,175,0,106,0,16,0,201,255,130,255,52,255,243,254,185,254,142,254,115,254,83,254,71,254,67,254,100,254,133,254,178,254,239,254,49,255,119,255,198,255,9,0,91,0,175,0,241,0,57,1,111,1,154,1,184,1,227,1,231,1,225,1,195,1,181,1,146,1,89,1,24,1,215,0,150,0,49,0,234,255,133,255,44,255,239,254,150,254,86,254,36,254,250,253,223,253,219,253,227,253,231,253,36,254,72,254,141,254,215,254,45,255,137,255,239,255,93,0,202,0,50,1,167,1,240,1,61,2,122,2,143,2,160,2,148,2,128,2,63,2,2,2,169,1,49,1,184,0,54,0,219,255,82,255,232,254,120,254,45,254,239,253,195,253,180,253,191,253,208,253,17,254,71,254,175,254,2,255,108,255,225,255,69,0,188,0,252,0,69,1,125,1,162,1,163,1,166,1,125,1,83,1,23,1,194,0,127,0,17,0,201,255,109,255,31,255,253,254,168,254,161,254,159,254,184,254,244,254,228,254,70,255,132,255,211,255,26,0,118,0,206,0,8,1,87,1,114,1,154,1,163,1,142,1,108,1,66,1,252,0,183,0,101,0,248,255,158,255,77,255,228,254,165,254,119,254,85,254,55,254,41,254,94,254,105,254,155,254,214,254,16,255,97,255,183,255,251,255,87,0,158,0,218,0,17,1,56,1,90,1,124,1,131,1,115,1,108,1,80,1,36,1,247,0,196,0,136,0,91,0,35,0,247,255,194,255,133,255,91,255,51,255,20,255,17,255,18,255,3,255,23,255,55,255,80,255,114,255,161,255,194,255,241,255,20,0,49,0,92,0,93,0,118,0,144,0,114,0,148,0,140,0,110,0,118,0,76,0,70,0,38,0,17,0,242,255,241,255,196,255,184,255,152,255,145,255,134,255,108,255,125,255,95,255,124,255,123,255,148,255,180,255,223,255,241,255,19,0,74,0,107,0,150,0,178,0,191,0,207,0,226,0,234,0,220,0,188,0,161,0,112,0,71,0,23,0,216,255,170,255,114,255,59,255,34,255,13,255,254,254,5,255,254,254,26,255,55,255,101,255,135,255,182,255,232,255,20,0,67,0,111,0,128,0,176,0,189,0,184,0,201,0,204,0,176,0,163,0,139,0,106,0,95,0,62,0,38,0,24,0,252,255,249,255,221,255,212,255,218,255,187,255,200,255,199,255,217,255,210,255,206,255,223,255,217,255,233,255,224,255,236,255,223,255,231,255,249,255,230,255,232,255,239,255,239,255,245,255,223,255,255,255,239,255,252,255,7,0,7,0,9,0,6,0,249,255,254,255,17,0,17,0,21,0,8,0,50,0,36,0,69,0,64,0,90,0,93,0,95,0,116,0,106,0,107,0,94,0,90,0,64,0,52,0,22,0,253,255,238,255,218,255,191,255,158,255,154,255,136,255,114,255,134,255,133,255,134,255,128,255,141,255,154,255,163,255,184,255,207,255,236,255,235,255,5,0,17,0,11,0,27,0,64,0,73,0,71,0,89,0,96,0,120,0,115,0,137,0,125,0,129,0,123,0,132,0,105,0,90,0,43,0,15,0,243,255,195,255,166,255,109,255,104,255,76,255,58,255,67,255,61,255,79,255,103,255,125,255,154,255,193,255,234,255,2,0,27,0,48,0,61,0,75,0,61,0,48,0,47,0,12,0,237,255,212,255,198,255,187,255,174,255,162,255,184,255,192,255,217,255,6,0,26,0,78,0,124,0,137,0,145,0,163,0,145,0,143,0,106,0,81,0,23,0,229,255,211,255,160,255,134,255,116,255,100,255,96,255,111,255,125,255,167,255,205,255,228,255,16,0,49,0,78,0,84,0,100,0,67,0,76,0,52,0,17,0,241,255,204,255,181,255,153,255,124,255,122,255,105,255,116,255,117,255,143,255,171,255,180,255,215,255,234,255,1,0,4,0,18,0,34,0,44,0,47,0,32,0,19,0,7,0,9,0,12,0,19,0,37,0,51,0,82,0,102,0,139,0,143,0,173,0,149,0,135,0,104,0,55,0,27,0,206,255,151,255,54,255,14,255,199,254,160,254,157,254,146,254,179,254,236,254,22,255,89,255,193,255,1,0,66,0,122,0,166,0,186,0,192,0,162,0,119,0,75,0,232,255,206,255,153,255,106,255,87,255,75,255,93,255,129,255,180,255,250,255,63,0,156,0,214,0,2,1,48,1,55,1,55,1,21,1,202,0,147,0,63,0,247,255,165,255,74,255,40,255,233,254,215,254,212,254,232,254,33,255,67,255,145,255,193,255,229,255,19,0,40,0,26,0,12,0,228,255,194,255,160,255,130,255,113,255,86,255,96,255,117,255,150,255,235,255,48,0,142,0,204,0,22,1,58,1,110,1,118,1,101,1,57,1,239,0,147,0,50,0,197,255,101,255,15,255,231,254,198,254,175,254,198,254,215,254,17,255,73,255,156,255,226,255,23,0,58,0,75,0,77,0,51,0,252,255,193,255,173,255,92,255,80,255,39,255,25,255,58,255,113,255,166,255,253,255,102,0,167,0,33,1,107,1,152,1,171,1,145,1,117,1,46,1,213,0,92,0,1,0,123,255,63,255,233,254,178,254,172,254,170,254,224,254,16,255,109,255,162,255,228,255,54,0,70,0,84,0,99,0,62,0,31,0,244,255,180,255,160,255,155,255,136,255,142,255,204,255,248,255,62,0,123,0,209,0,28,1,76,1,85,1,85,1,59,1,254,0,193,0,110,0,21,0,181,255,139,255,97,255,59,255,66,255,89,255,127,255,173,255,244,255,57,0,106,0,152,0,174,0,172,0,150,0,111,0,67,0,9,0,211,255,159,255,124,255,102,255,91,255,100,255,139,255,197,255,251,255,54,0,109,0,153,0,187,0,204,0,196,0,183,0,146,0,118,0,68,0,13,0,255,255,220,255,223,255,232,255,253,255,22,0,54,0,83,0,123,0,131,0,149,0,127,0,99,0,61,0,5,0,218,255,164,255,114,255,78,255,79,255,91,255,130,255,150,255,226,255,7,0,80,0,129,0,142,0,177,0,163,0,145,0,111,0,86,0,6,0,246,255,176,255,173,255,179,255,178,255,191,255,231,255,16,0,51,0,76,0,105,0,145,0,110,0,106,0,84,0,53,0,1,0,226,255,185,255,144,255,108,255,101,255,108,255,112,255,130,255,165,255,202,255,209,255,12,0,30,0,66,0,66,0,65,0,75,0,73,0,82,0,85,0,91,0,90,0,100,0,108,0,120,0,117,0,112,0,109,0,101,0,69,0,43,0,12,0,3,0,228,255,211,255,196,255,190,255,185,255,193,255,215,255,202,255,206,255,226,255,194,255,205,255,166,255,148,255,142,255,116,255,111,255,103,255,148,255,161,255,228,255,21,0,98,0,140,0,212,0,247,0,15,1,32,1,244,0,238,0,182,0,119,0,67,0,253,255,201,255,180,255,160,255,199,255,197,255,250,255,45,0,76,0,120,0,127,0,137,0,105,0,67,0,4,0,188,255,119,255,59,255,16,255,252,254,255,254,17,255,83,255,130,255,219,255,37,0,117,0,164,0,194,0,199,0,187,0,165,0,117,0,79,0,20,0,11,0,241,255,253,255,5,0,31,0,68,0,112,0,153,0,156,0,177,0,147,0,125,0,79,0,2,0,209,255,145,255,98,255,64,255,60,255,86,255,82,255,134,255,159,255,200,255,230,255,238,255,1,0,230,255,214,255,172,255,149,255,113,255,134,255,120,255,167,255,223,255,31,0,110,0,168,0,235,0,40,1,45,1,70,1,33,1,223,0,172,0,61,0,7,0,202,255,169,255,137,255,142,255,171,255,207,255,5,0,48,0,89,0,105,0,85,0,66,0,8,0,191,255,120,255,71,255,7,255,228,254,235,254,231,254,6,255,61,255,144,255,204,255,13,0,89,0,108,0,138,0,135,0,125,0,79,0,77,0,36,0,43,0,48,0,60,0,95,0,111,0,141,0,156,0,196,0,177,0,168,0,133,0,92,0,55,0,5,0,211,255,192,255,156,255,153,255,198,255,202,255,242,255,10,0,12,0,8,0,250,255,214,255,185,255,134,255,69,255,29,255,21,255,255,254,2,255,40,255,90,255,149,255,242,255,60,0,127,0,167,0,202,0,191,0,179,0,140,0,81,0,31,0,238,255,211,255,183,255,177,255,214,255,249,255,42,0,84,0,112,0,143,0,132,0,133,0,117,0,42,0,255,255,213,255,165,255,106,255,65,255,62,255,46,255,61,255,102,255,114,255,139,255,161,255,189,255,206,255,196,255,205,255,219,255,200,255,215,255,214,255,236,255,13,0,29,0,47,0,71,0,88,0,102,0,74,0,67,0,50,0,30,0,245,255,235,255,214,255,203,255,212,255,227,255,241,255,7,0,31,0,35,0,50,0,37,0,23,0,247,255,215,255,167,255,119,255,89,255,52,255,54,255,60,255,92,255,132,255,175,255,226,255,5,0,48,0,74,0,74,0,80,0,78,0,38,0,8,0,246,255,217,255,215,255,223,255,205,255,225,255,250,255,14,0,35,0,51,0,37,0,43,0,9,0,217,255,229,255,180,255,147,255,148,255,139,255,150,255,167,255,205,255,245,255,253,255,39,0,63,0,51,0,48,0,45,0,15,0,237,255,220,255,197,255,195,255,195,255,200,255,232,255,249,255,12,0,41,0,62,0,56,0,71,0,52,0,16,0,7,0,241,255,210,255,193,255,169,255,190,255,207,255,225,255,231,255,12,0,45,0,57,0,70,0,53,0,36,0,12,0,243,255,202,255,167,255,132,255,100,255,93,255,110,255,123,255,149,255,175,255,194,255,235,255,8,0,36,0,31,0,53,0,63,0,58,0,57,0,62,0,62,0,76,0,81,0,86,0,64,0,79,0,87,0,81,0,59,0,48,0,36,0,3,0,245,255,218,255,216,255,193,255,191,255,200,255,212,255,203,255,210,255,222,255,213,255,213,255,205,255,198,255,178,255,180,255,172,255,190,255,193,255,193,255,231,255,250,255,26,0,48,0,63,0,81,0,93,0,76,0,104,0,97,0,79,0,74,0,92,0,91,0,98,0,97,0,111,0,134,0,137,0,144,0,135,0,134,0,131,0,95,0,79,0,72,0,40,0,26,0,23,0,244,255,223,255,214,255,202,255,184,255,181,255,164,255,161,255,138,255,132,255,122,255,119,255,105,255,127,255,145,255,162,255,186,255,209,255,254,255,14,0,25,0,67,0,60,0,49,0,36,0,40,0,43,0,16,0,26,0,44,0,53,0,75,0,92,0,112,0,138,0,167,0,162,0,171,0,144,0,119,0,82,0,55,0,29,0,9,0,219,255,204,255,190,255,186,255,168,255,158,255,165,255,149,255,143,255,132,255,137,255,98,255,109,255,90,255,115,255,130,255,135,255,166,255,187,255,217,255,247,255,28,0,24,0,62,0,83,0,89,0,108,0,127,0,127,0,138,0,157,0,187,0,176,0,204,0,218,0,182,0,153,0,141,0,105,0,49,0,7,0,225,255,178,255,139,255,110,255,93,255,118,255,127,255,140,255,166,255,181,255,179,255,203,255,193,255,183,255,171,255,149,255,154,255,148,255,152,255,158,255,165,255,210,255,243,255,7,0,63,0,71,0,102,0,162,0,139,0,155,0,145,0,125,0,113,0,109,0,103,0,97,0,89,0,78,0,73,0,81,0,66,0,35,0,20,0,3,0,226,255,214,255,200,255,164,255,148,255,127,255,117,255,129,255,133,255,137,255,160,255,154,255,171,255,201,255,213,255,210,255,220,255,207,255,229,255,238,255,11,0,20,0,32,0,55,0,53,0,77,0,81,0,73,0,78,0,75,0,72,0,89,0,59,0,46,0,23,0,30,0,22,0,236,255,250,255,231,255,228,255,234,255,230,255,234,255,212,255,230,255,227,255,229,255,227,255,213,255,242,255,235,255,231,255,247,255,238,255,0,0,245,255,224,255,247,255,229,255,243,255,234,255,236,255,250,255,4,0,9,0,249,255,24,0,10,0,27,0,30,0,37,0,35,0,20,0,16,0,252,255,249,255,243,255,253,255,240,255,9,0,10,0,24,0,42,0,55,0,81,0,80,0,76,0,75,0,80,0,75,0,46,0,54,0,35,0,30,0,42,0,25,0,26,0,18,0,23,0,16,0,10,0,3,0,28,0,12,0,246,255,9,0,240,255,249,255,223,255,197,255,205,255,198,255,192,255,196,255,208,255,178,255,204,255,212,255,230,255,248,255,251,255,17,0,19,0,46,0,45,0,37,0,75,0,71,0,81,0,87,0,95,0,80,0,77,0,64,0,62,0,60,0,46,0,37,0,24,0,32,0,12,0,254,255,3,0,5,0,9,0,243,255,249,255,228,255,214,255,217,255,192,255,183,255,172,255,154,255,147,255,138,255,134,255,143,255,158,255,144,255,149,255,177,255,191,255,211,255,226,255,243,255,241,255,21,0,23,0,35,0,72,0,81,0,98,0,124,0,122,0,128,0,165,0,154,0,176,0,149,0,144,0,135,0,113,0,88,0,60,0,45,0,245,255,236,255,209,255,182,255,160,255,138,255,133,255,117,255,123,255,124,255,129,255,122,255,124,255,115,255,127,255,142,255,150,255,185,255,170,255,193,255,216,255,233,255,16,0,52,0,58,0,79,0,88,0,104,0,116,0,112,0,106,0,123,0,93,0,111,0,106,0,84,0,88,0,68,0,62,0,46,0,43,0,21,0,22,0,4,0,4,0,243,255,249,255,242,255,217,255,220,255,186,255,193,255,191,255,172,255,180,255,159,255,156,255,171,255,174,255,187,255,180,255,207,255,216,255,208,255,227,255,228,255,228,255,1,0,255,255,13,0,17,0,34,0,60,0,69,0,82,0,86,0,92,0,109,0,113,0,109,0,95,0,69,0,52,0,33,0,21,0,2,0,246,255,229,255,211,255,222,255,214,255,214,255,217,255,214,255,218,255,214,255,212,255,196,255,191,255,200,255,171,255,172,255,168,255,174,255,185,255,201,255,219,255,249,255,17,0,27,0,35,0,59,0,70,0,72,0,75,0,65,0,55,0,37,0,33,0,25,0,34,0,31,0,34,0,48,0,13,0,36,0,49,0,22,0,27,0,28,0,6,0,255,255,236,255,231,255,208,255,218,255,211,255,197,255,208,255,203,255,211,255,203,255,219,255,217,255,231,255,235,255,225,255,216,255,224,255,222,255,213,255,225,255,228,255,248,255,250,255,11,0,11,0,23,0,40,0,27,0,33,0,34,0,30,0,23,0,20,0,19,0,7,0,4,0,19,0,3,0,38,0,17,0,22,0,19,0,40,0,34,0,20,0,14,0,236,255,238,255,213,255,210,255,203,255,203,255,193,255,181,255,187,255,196,255,202,255,202,255,209,255,229,255,213,255,218,255,223,255,232,255,243,255,235,255,1,0,254,255,22,0,40,0,14,0,44,0,35,0,42,0,49,0,45,0,47,0,38,0,45,0,23,0,32,0,15,0,16,0,16,0,23,0,9,0,1,0,11,0,0,0,250,255,233,255,221,255,197,255,198,255,185,255,185,255,180,255,191,255,185,255,177,255,195,255,188,255,209,255,207,255,229,255,233,255,231,255,214,255,237,255,237,255,238,255,2,0,245,255,22,0,30,0,62,0,51,0,69,0,61,0,62,0,49,0,52,0,46,0,34,0,14,0,2,0,14,0,254,255,253,255,238,255,240,255,251,255,2,0,245,255,252,255,244,255,230,255,227,255,207,255,203,255,206,255,206,255,188,255,214,255,208,255,214,255,232,255,228,255,1,0,240,255,15,0,22,0,22,0,41,0,36,0,56,0,43,0,47,0,51,0,56,0,48,0,53,0,62,0,61,0,52,0,37,0,38,0,20,0,7,0,0,0,242,255,244,255,243,255,236,255,238,255,241,255,234,255,233,255,236,255,234,255,242,255,244,255,250,255,1,0,246,255,241,255,5,0,244,255,4,0,13,0,6,0,5,0,23,0,26,0,28,0,50,0,42,0,59,0,53,0,42,0,36,0,40,0,23,0,7,0,249,255,5,0,250,255,0,0,1,0,250,255,253,255,255,255,242,255,4,0,15,0,18,0,16,0,12,0,14,0,20,0,7,0,13,0,21,0,244,255,16,0,243,255,246,255,2,0,237,255,248,255,244,255,250,255,234,255,246,255,255,255,246,255,1,0,244,255,17,0,216,255,231,255,11,0,235,255,1,0,244,255,227,255,213,255,223,255,224,255,226,255,214,255,245,255,219,255,240,255,246,255,236,255,238,255,254,255,255,255,245,255,1,0,246,255,250,255,234,255,238,255,245,255,239,255,252,255,249,255,254,255,23,0,11,0,16,0,19,0,29,0,6,0,2,0,254,255,246,255,225,255,235,255,233,255,222,255,222,255,205,255,239,255,221,255,229,255,241,255,248,255,243,255,244,255,3,0,253,255,24,0,32,0,35,0,47,0,40,0,45,0,60,0,57,0,64,0,58,0,46,0,54,0,54,0,46,0,56,0,42,0,55,0,42,0,43,0,52,0,51,0,65,0,63,0,46,0,41,0,13,0,254,255,3,0,241,255,242,255,244,255,244,255,249,255,237,255,7,0,0,0,10,0,13,0,7,0,255,255,253,255,6,0,246,255,231,255,210,255,232,255,215,255,204,255,226,255,217,255,220,255,240,255,231,255,4,0,8,0,24,0,26,0,39,0,37,0,30,0,29,0,12,0,27,0,10,0,35,0,39,0,32,0,29,0,3,0,11,0,10,0,253,255,1,0,231,255,233,255,219,255,220,255,221,255,202,255,207,255,202,255,196,255,210,255,205,255,209,255,216,255,228,255,232,255,231,255,229,255,232,255,227,255,205,255,236,255,241,255,244,255,251,255,8,0,8,0,13,0,44,0,19,0,41,0,48,0,34,0,72,0,30,0,37,0,40,0,19,0,37,0,22,0,5,0,16,0,15,0,15,0,6,0,6,0,2,0,5,0,253,255,243,255,224,255,237,255,234,255,216,255,221,255,198,255,190,255,194,255,188,255,207,255,216,255,225,255,216,255,216,255,235,255,244,255,4,0,0,0,15,0,16,0,29,0,35,0,16,0,52,0,23,0,37,0,43,0,37,0,46,0,39,0,16,0,22,0,13,0,14,0,12,0,8,0,245,255,0,0,246,255,232,255,212,255,215,255,208,255,198,255,220,255,190,255,197,255,190,255,193,255,224,255,200,255,220,255,217,255,222,255,240,255,246,255,248,255,2,0,10,0,2,0,15,0,24,0,18,0,37,0,36,0,50,0,52,0,43,0,46,0,26,0,26,0,20,0,249,255,15,0,11,0,244,255,23,0,253,255,10,0,33,0,21,0,13,0,3,0,25,0,3,0,235,255,236,255,220,255,219,255,222,255,211,255,217,255,234,255,233,255,239,255,253,255,3,0,9,0,34,0,36,0,12,0,30,0,13,0,5,0,20,0,15,0,255,255,0,0,6,0,4,0,14,0,13,0,27,0,40,0,29,0,39,0,18,0,6,0,3,0,253,255,0,0,233,255,238,255,234,255,233,255,221,255,222,255,226,255,230,255,238,255,241,255,243,255,244,255,246,255,224,255,226,255,233,255,233,255,244,255,238,255,240,255,251,255,6,0,6,0,25,0,24,0,22,0,3,0,253,255,5,0,10,0,249,255,255,255,238,255,253,255,13,0,3,0,15,0,16,0,14,0,10,0,246,255,1,0,244,255,236,255,224,255,221,255,228,255,210,255,225,255,232,255,227,255,208,255,232,255,231,255,232,255,242,255,11,0,232,255,243,255,11,0,237,255,242,255,245,255,254,255,240,255,10,0,8,0,8,0,32,0,24,0,49,0,38,0,32,0,21,0,30,0,255,255,2,0,13,0,1,0,250,255,6,0,252,255,16,0,23,0,20,0,9,0,13,0,11,0,6,0,20,0,8,0,7,0,5,0,243,255,231,255,249,255,215,255,229,255,233,255,238,255,2,0,246,255,1,0,1,0,14,0,30,0,8,0,48,0,21,0,25,0,42,0,14,0,43,0,9,0,27,0,2,0,25,0,24,0,21,0,33,0,38,0,52,0,26,0,46,0,32,0,48,0,34,0,22,0,29,0,255,255,8,0,8,0,2,0,5,0,253,255,5,0,239,255,0,0,254,255,10,0,31,0,12,0,13,0,5,0,9,0,5,0,18,0,9,0,19,0,32,0,35,0,10,0,33,0,28,0,25,0,27,0,20,0,20,0,2,0,16,0,19,0,6,0,8,0,16,0,255,255,9,0,27,0,6,0,23,0,26,0,19,0,245,255,5,0,12,0,232,255,222,255,220,255,223,255,212,255,219,255,219,255,223,255,213,255,223,255,225,255,233,255,249,255,236,255,243,255,247,255,2,0,239,255,221,255,246,255,225,255,251,255,226,255,244,255,223,255,241,255,250,255,249,255,254,255,2,0,246,255,6,0,11,0,1,0,4,0,3,0,254,255,4,0,0,0,6,0,12,0,255,255,28,0,16,0,9,0,10,0,239,255,1,0,251,255,243,255,238,255,232,255,224,255,241,255,244,255,230,255,237,255,234,255,239,255,221,255,238,255,222,255,234,255,228,255,240,255,243,255,243,255,5,0,242,255,251,255,1,0,13,0,12,0,22,0,26,0,18,0,27,0,28,0,22,0,13,0,34,0,12,0,19,0,25,0,25,0,25,0,11,0,11,0,253,255,15,0,254,255,5,0,249,255,251,255,253,255,236,255,246,255,239,255,223,255,241,255,228,255,236,255,246,255,242,255,19,0,242,255,244,255,0,0,252,255,4,0,249,255,5,0,250,255,9,0,15,0,9,0,29,0,34,0,30,0,17,0,17,0,35,0,43,0,37,0,40,0,36,0,33,0,21,0,20,0,43,0,13,0,6,0,1,0,36,0,2,0,3,0,18,0,255,255,0,0,245,255,255,255,228,255,234,255,240,255,243,255,236,255,243,255,225,255,233,255,228,255,245,255,2,0,254,255,19,0,26,0,16,0,21,0,19,0,39,0,27,0,31,0,27,0,24,0,17,0,13,0,21,0,23,0,15,0,20,0,23,0,26,0,9,0,22,0,26,0,4,0,13,0,247,255,247,255,219,255,232,255,235,255,213,255,218,255,223,255,212,255,217,255,219,255,201,255,210,255,226,255,212,255,217,255,226,255,231,255,221,255,238,255,234,255,228,255,3,0,249,255,246,255,4,0,251,255,2,0,6,0,14,0,28,0,20,0,29,0,32,0,21,0,20,0,24,0,13,0,25,0,33,0,27,0,22,0,32,0,14,0,5,0,4,0,246,255,1,0,238,255,237,255,254,255,250,255,244,255,253,255,250,255,240,255,226,255,221,255,219,255,228,255,251,255,234,255,3,0,248,255,4,0,252,255,2,0,12,0,13,0,22,0,23,0,24,0,19,0,10,0,21,0,20,0,7,0,26,0,8,0,12,0,5,0,252,255,8,0,238,255,8,0,5,0,2,0,246,255,242,255,235,255,240,255,244,255,242,255,254,255,240,255,240,255,226,255,216,255,215,255,216,255,221,255,229,255,215,255,218,255,225,255,230,255,228,255,246,255,230,255,249,255,255,255,4,0,33,0,10,0,11,0,12,0,253,255,10,0,11,0,11,0,8,0,2,0,0,0,253,255,13,0,246,255,245,255,236,255,246,255,242,255,228,255,248,255,244,255,252,255,237,255,239,255,231,255,232,255,234,255,235,255,246,255,243,255,248,255,226,255,225,255,251,255,247,255,246,255,12,0,5,0,7,0,253,255,16,0,7,0,6,0,20,0,22,0,10,0,26,0,23,0,20,0,42,0,29,0,25,0,13,0,11,0,2,0,255,255,7,0,6,0,247,255,240,255,241,255,248,255,245,255,242,255,248,255,246,255,221,255,247,255,254,255,234,255,239,255,242,255,242,255,235,255,247,255,255,255,255,255,248,255,5,0,12,0,3,0,12,0,2,0,0,0,10,0,12,0,11,0,254,255,7,0,11,0,5,0,14,0,24,0,14,0,9,0,17,0,11,0,252,255,7,0,255,255,246,255,242,255,232,255,239,255,248,255,249,255,239,255,235,255,237,255,236,255,216,255,224,255,234,255,234,255,230,255,223,255,248,255,238,255,239,255,247,255,241,255,255,255,255,255,20,0,11,0,33,0,17,0,6,0,16,0,252,255,16,0,18,0,10,0,5,0,11,0,3,0,15,0,16,0,5,0,11,0,7,0,246,255,255,255,239,255,252,255,237,255,253,255,254,255,252,255,255,255,229,255,240,255,230,255,235,255,229,255,225,255,237,255,247,255,243,255,250,255,0,0,251,255,248,255,10,0,253,255,244,255,0,0,252,255,243,255,23,0,254,255,2,0,19,0,9,0,17,0,248,255,255,255,17,0,1,0,20,0,10,0,7,0,15,0,8,0,249,255,244,255,238,255,246,255,249,255,253,255,0,0,245,255,251,255,5,0,244,255,252,255,4,0,7,0,4,0,253,255,239,255,243,255,249,255,242,255,14,0,249,255,4,0,254,255,19,0,5,0,26,0,35,0,16,0,24,0,19,0,22,0,15,0,26,0,26,0,27,0,24,0,40,0,39,0,29,0,29,0,32,0,30,0,20,0,7,0,11,0,4,0,250,255,249,255,253,255,1,0,243,255,0,0,240,255,246,255,242,255,243,255,236,255,229,255,239,255,236,255,239,255,232,255,236,255,244,255,0,0,9,0,252,255,239,255,243,255,245,255,236,255,254,255,250,255,4,0,9,0,12,0,21,0,15,0,33,0,23,0,28,0,29,0,20,0,20,0,26,0,30,0,15,0,25,0,7,0,18,0,254,255,20,0,23,0,17,0,2,0,4,0,24,0,252,255,25,0,8,0,251,255,10,0,240,255,241,255,238,255,4,0,238,255,252,255,244,255,242,255,254,255,246,255,249,255,250,255,245,255,12,0,9,0,8,0,8,0,253,255,34,0,17,0,22,0,11,0,23,0,37,0,20,0,35,0,28,0,40,0,29,0,42,0,31,0,27,0,28,0,18,0,17,0,254,255,7,0,2,0,0,0,14,0,12,0,246,255,252,255,227,255,238,255,252,255,241,255,253,255,242,255,244,255,230,255,236,255,231,255,244,255,246,255,243,255,236,255,2,0,252,255,250,255,21,0,3,0,22,0,12,0,19,0,12,0,41,0,33,0,44,0,51,0,33,0,21,0,48,0,39,0,32,0,47,0,5,0,13,0,15,0,5,0,13,0,8,0,8,0,15,0,11,0,2,0,243,255,251,255,252,255,235,255,246,255,241,255,230,255,236,255,223,255,252,255,240,255,231,255,2,0,251,255,0,0,6,0,249,255,18,0,236,255,236,255,15,0,9,0,18,0,15,0,27,0,24,0,20,0,22,0,28,0,32,0,30,0,28,0,11,0,5,0,26,0,255,255,1,0,13,0,248,255,19,0,244,255,13,0,241,255,252,255,244,255,244,255,236,255,237,255,233,255,211,255,216,255,203,255,219,255,214,255,216,255,210,255,217,255,205,255,237,255,222,255,237,255,237,255,229,255,243,255,236,255,11,0,239,255,2,0,7,0,12,0,25,0,19,0,23,0,16,0,15,0,18,0,5,0,7,0,20,0,3,0,6,0,254,255,242,255,237,255,236,255,241,255,222,255,238,255,219,255,234,255,238,255,216,255,236,255,230,255,212,255,224,255,228,255,222,255,227,255,223,255,223,255,220,255,229,255,230,255,230,255,249,255,240,255,247,255,5,0,247,255,248,255,3,0,247,255,6,0,15,0,2,0,28,0,17,0,245,255,253,255,254,255,10,0,24,0,253,255,253,255,253,255,251,255,250,255,244,255,239,255,239,255,239,255,241,255,249,255,226,255,239,255,244,255,2,0,252,255,229,255,249,255,233,255,226,255,251,255,250,255,245,255,1,0,21,0,15,0,13,0,12,0,252,255,254,255,254,255,11,0,12,0,3,0,249,255,19,0,18,0,13,0,23,0,17,0,11,0,2,0,31,0,29,0,14,0,13,0,20,0,12,0,14,0,23,0,1,0,5,0,10,0,1,0,2,0,255,255,245,255,253,255,252,255,0,0,250,255,255,255,232,255,234,255,232,255,246,255,251,255,234,255,245,255,234,255,237,255,237,255,244,255,247,255,243,255,235,255,230,255,1,0,239,255,247,255,250,255,245,255,245,255,7,0,16,0,254,255,2,0,14,0,6,0,255,255,246,255,1,0,246,255,251,255,253,255,9,0,10,0,237,255,21,0,251,255,249,255,255,255,246,255,234,255,249,255,10,0,245,255,245,255,7,0,7,0,1,0,246,255,255,255,6,0,251,255,252,255,11,0,13,0,1,0,8,0,22,0,13,0,13,0,31,0,16,0,34,0,32,0,46,0,19,0,24,0,38,0,36,0,18,0,11,0,22,0,25,0,17,0,17,0,15,0,11,0,12,0,252,255,14,0,2,0,255,255,2,0,234,255,249,255,255,255,248,255,0,0,8,0,3,0,4,0,244,255,243,255,247,255,1,0,239,255,252,255,13,0,11,0,3,0,10,0,3,0,25,0,11,0,255,255,18,0,18,0,28,0,22,0,40,0,26,0,36,0,31,0,9,0,23,0,8,0,252,255,22,0,14,0,23,0,26,0,12,0,9,0,0,0,250,255,239,255,237,255,246,255,247,255,251,255,250,255,232,255,9,0,248,255,234,255,253,255,247,255,254,255,240,255,0,0,9,0,15,0,255,255,21,0,4,0,245,255,12,0,9,0,21,0,37,0,44,0,19,0,26,0,27,0,31,0,2,0,26,0,27,0,17,0,19,0,255,255,17,0,247,255,20,0,253,255,251,255,1,0,229,255,236,255,216,255,226,255,229,255,241,255,220,255,224,255,231,255,226,255,247,255,243,255,244,255,231,255,252,255,250,255,231,255,243,255,238,255,248,255,234,255,233,255,239,255,236,255,252,255,248,255,239,255,245,255,241,255,241,255,239,255,218,255,219,255,238,255,244,255,223,255,246,255,238,255,244,255,247,255,239,255,0,0,248,255,244,255,0,0,6,0,4,0,253,255,1,0,254,255,255,255,6,0,254,255,1,0,242,255,248,255,242,255,246,255,233,255,242,255,5,0,1,0,253,255,242,255,237,255,236,255,255,255,255,255,242,255,252,255,242,255,4,0,247,255,239,255,244,255,248,255,249,255,2,0,2,0,253,255,12,0,10,0,29,0,2,0,2,0,17,0,2,0,7,0,4,0,252,255,247,255,247,255,243,255,255,255,236,255,244,255,232,255,233,255,237,255,248,255,253,255,250,255,7,0,244,255,4,0,1,0,5,0,252,255,10,0,1,0,14,0,1,0,2,0,255,255,5,0,22,0,5,0,235,255,244,255,249,255,243,255,255,255,0,0,251,255,251,255,239,255,247,255,247,255,245,255,235,255,248,255,7,0,241,255,247,255,1,0,246,255,250,255,248,255,241,255,252,255,244,255,4,0,1,0,255,255,15,0,3,0,253,255,252,255,253,255,247,255,255,255,9,0,16,0,19,0,16,0,21,0,15,0,17,0,26,0,10,0,1,0,28,0,27,0,36,0,25,0,35,0,8,0,6,0,6,0,9,0,5,0,3,0,4,0,8,0,11,0,253,255,20,0,255,255,7,0,253,255,250,255,5,0,238,255,251,255,248,255,248,255,240,255,240,255,250,255,254,255,253,255,255,255,11,0,2,0,4,0,10,0,19,0,12,0,20,0,21,0,7,0,1,0,5,0,6,0,252,255,1,0,12,0,3,0,9,0,12,0,18,0,9,0,252,255,2,0,248,255,251,255,0,0,9,0,5,0,255,255,252,255,10,0,7,0,253,255,13,0,2,0,251,255,248,255,10,0,9,0,15,0,250,255,11,0,22,0,18,0,27,0,19,0,23,0,22,0,36,0,13,0,71,0,29,0,28,0,28,0,23,0,21,0,9,0,19,0,255,255,10,0,8,0,12,0,12,0,24,0,9,0,247,255,239,255,8,0,236,255,4,0,255,255,4,0,242,255,251,255,254,255,248,255,249,255,229,255,6,0,240,255,254,255,6,0,246,255,0,0,4,0,247,255,4,0,9,0,8,0,3,0,15,0,9,0,6,0,30,0,6,0,26,0,18,0,16,0,2,0,10,0,9,0,23,0,14,0,28,0,18,0,16,0,7,0,12,0,15,0,14,0,17,0,2,0,242,255,250,255,243,255,229,255,251,255,249,255,234,255,236,255,8,0,242,255,241,255,237,255,246,255,249,255,246,255,241,255,238,255,250,255,252,255,10,0,249,255,249,255,9,0,8,0,247,255,21,0,3,0,245,255,6,0,247,255,3,0,15,0,245,255,7,0,251,255,4,0,19,0,11,0,253,255,252,255,6,0,237,255,231,255,240,255,223,255,242,255,239,255,239,255,230,255,238,255,243,255,222,255,245,255,242,255,250,255,224,255,222,255,221,255,235,255,242,255,233,255,243,255,227,255,235,255,226,255,235,255,238,255,231,255,230,255,234,255,235,255,232,255,244,255,233,255,230,255,249,255,241,255,235,255,1,0,252,255,8,0,3,0,4,0,251,255,7,0,7,0,3,0,1,0,4,0,255,255,252,255,227,255,246,255,4,0,255,255,5,0,249,255,253,255,252,255,240,255,237,255,236,255,236,255,242,255,229,255,238,255,230,255,234,255,239,255,241,255,243,255,1,0,247,255,239,255,4,0,3,0,2,0,250,255,255,255,6,0,16,0,4,0,1,0,2,0,250,255,5,0,11,0,12,0,4,0,0,0,254,255,18,0,19,0,18,0,16,0,16,0,19,0,8,0,8,0,0,0,7,0,5,0,19,0,8,0,254,255,18,0,6,0,249,255,4,0,251,255,16,0,1,0,10,0,22,0,26,0,26,0,25,0,3,0,23,0,22,0,13,0,15,0,27,0,23,0,9,0,28,0,3,0,76,73,83,84,104,0,0,0,73,78,70,79,73,78,65,77,14,0,0,0,84,101,101,102,97,120,116,114,111,112,102,101,110,0,73,80,82,68,8,0,0,0,84,101,101,102,97,120,0,0,73,65,82,84,10,0,0,0,65,108,115,119,101,105,100,101,114,0,73,67,82,68,6,0,0,0,50,48,50,54,0,0,73,71,78,82,12,0,0,0,83,111,117,110,100,32,67,108,105,112,0,0,73,84,82,75,2,0,0,0,49,0,105,100,51,32,120,0,0,0,73,68,51,3,0,0,0,0,0,109,84,80,69,49,0,0,0,10,0,0,0,65,108,115,119,101,105,100,101,114,84,73,84,50,0,0,0,14,0,0,0,84,101,101,102,97,120,116,114,111,112,102,101,110,84,68,82,67,0,0,0,5,0,0,0,50,48,50,54,84,65,76,66,0,0,0,7,0,0,0,84,101,101,102,97,120,84,82,67,75,0,0,0,2,0,0,0,49,84,67,79,78,0,0,0,11,0,0,0,83,111,117,110,100,32,67,108,105,112,0};
-const unsigned int sound_size = 18342;
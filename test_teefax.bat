@@ -148,6 +148,10 @@ set T=--eco (Energiesparmodus, Exit 0)
 "%EXE%" 1s --mute --nomsg --eco >nul 2>&1
 call :chk %errorlevel% 0
 
+set T=--watch-config (Exit 0)
+"%EXE%" 1s --mute --nomsg --watch-config >nul 2>&1
+call :chk %errorlevel% 0
+
 set T=--sound mit Datei
 "%EXE%" 1s --mute --nomsg --sound "C:\Windows\Media\chimes.wav" >nul 2>&1
 call :chk %errorlevel% 0
@@ -180,6 +184,110 @@ set T=--focus nicht vorhandenes Fenster (kein Absturz, Exit 0)
 "%EXE%" 1s --mute --nomsg --focus "___teefax_nx___" >nul 2>&1
 call :chk %errorlevel% 0
 
+set T=--audio-backend null
+"%EXE%" 1s --nomsg --audio-backend null >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--audio-backend wav schreibt WAV-Datei und Markierungen
+del teefax_smoke.wav teefax_smoke.wav.txt >nul 2>&1
+"%EXE%" 3s --prealarm 2 --nomsg --audio-backend wav:teefax_smoke.wav >nul 2>&1
+findstr /c:"deadline" teefax_smoke.wav.txt >nul 2>&1
+call :chk %errorlevel% 0
+del teefax_smoke.wav teefax_smoke.wav.txt >nul 2>&1
+
+set T=--sound wird dekodiert und ueber den Mixer abgespielt
+"%EXE%" 1s --nomsg --sound "C:\Windows\Media\chimes.wav" --audio-backend null >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--sound mit unlesbarer Datei gibt Exit 1
+"%EXE%" 1s --nomsg --sound "%~f0" >nul 2>&1
+call :chk %errorlevel% 1
+
+rem  IMA-ADPCM mit samplesPerBlock 65535 bei 8-Byte-Bloecken (passend waeren 9)
+set T=--sound mit unplausiblem IMA-ADPCM-Kopf gibt Exit 1
+powershell -NoProfile -Command "$h=[byte[]](0x52,0x49,0x46,0x46,0x28,0,1,0,0x57,0x41,0x56,0x45,0x66,0x6D,0x74,0x20,20,0,0,0,0x11,0,1,0,0x22,0x56,0,0,0x11,0x2B,0,0,8,0,4,0,2,0,0xFF,0xFF,0x64,0x61,0x74,0x61,0,0,1,0); [IO.File]::WriteAllBytes('teefax_bad.wav', $h + (New-Object byte[] 65536))" >nul 2>&1
+"%EXE%" 1s --nomsg --sound teefax_bad.wav --audio-backend null >nul 2>&1
+call :chk %errorlevel% 1
+del teefax_bad.wav >nul 2>&1
+
+set T=--tone gong
+"%EXE%" 1s --nomsg --tone gong --audio-backend null >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--tone mit unbekanntem Namen gibt Exit 1
+"%EXE%" 1s --nomsg --tone xyz >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--metronome mit Zeitangabe
+"%EXE%" 2s --mute --nomsg --metronome 120 --accent Xxx. --audio-backend null >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--beep-every unter 50ms gibt Exit 1
+"%EXE%" 2s --mute --nomsg --beep-every 10ms >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--accent mit ungueltigem Muster gibt Exit 1
+"%EXE%" 2s --mute --nomsg --metronome 60 --accent abc >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--audio-backend mit ungueltigem Wert gibt Exit 1
+"%EXE%" 1s --mute --nomsg --audio-backend xyz >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--bar smooth
+"%EXE%" 1s --mute --nomsg --bar smooth >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--bar mit ungueltigem Stil gibt Exit 1
+"%EXE%" 1s --mute --nomsg --bar xyz >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--fps ausserhalb 1..100 gibt Exit 1
+"%EXE%" --stopwatch --fps 500 >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--output jsonl meldet fired und stopped
+"%EXE%" 1s --mute --nomsg --output jsonl --output-tick 100ms >teefax_events.txt 2>nul
+findstr /c:"fired" teefax_events.txt >nul 2>&1 && findstr /c:"stopped" teefax_events.txt >nul 2>&1
+call :chk %errorlevel% 0
+del teefax_events.txt >nul 2>&1
+
+set T=--output mit ungueltigem Format gibt Exit 1
+"%EXE%" 1s --mute --nomsg --output xml >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--sw start/lap/stop/show ueber getrennte Aufrufe
+"%EXE%" --sw smoketest start >nul 2>&1
+"%EXE%" --sw smoketest lap >nul 2>&1
+"%EXE%" --sw smoketest stop >nul 2>&1
+"%EXE%" --sw smoketest show 2>nul | findstr /c:"smoketest:" >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--sw remove, danach show gibt Exit 1
+"%EXE%" --sw smoketest remove >nul 2>&1
+"%EXE%" --sw smoketest show >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--sw mit unbekanntem Befehl gibt Exit 1
+"%EXE%" --sw smoketest jump >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--status gibt Exit 0 zurueck
+"%EXE%" --status >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=--attach mit unbekannter ID gibt Exit 1
+"%EXE%" --attach 0 >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--control mit unbekannter ID gibt Exit 1
+"%EXE%" --control 0 pause >nul 2>&1
+call :chk %errorlevel% 1
+
+set T=--control mit ungueltigem Befehl gibt Exit 1
+"%EXE%" --control 0 jump >nul 2>&1
+call :chk %errorlevel% 1
+
 rem ── 5. Sprachen ──────────────────────────────────────────────────────
 
 set T=--lang en
@@ -210,6 +318,37 @@ echo --mute > teefax.ini
 call :chk %errorlevel% 0
 del teefax.ini >nul 2>&1
 
+set T=--calibrate-audio ohne echtes Geraet (Exit 1)
+"%EXE%" --calibrate-audio --audio-backend null >nul 2>&1
+call :chk %errorlevel% 1
+
+rem  Messwerte in die ausgelieferte INI schreiben (braucht ein echtes Ausgabegeraet):
+rem  Hilfekommentare und Zeilen mit weiteren Schaltern muessen erhalten bleiben,
+rem  nur "#<Schalter> <Wert>" wird ersetzt, sonst angehaengt.
+set T=--calibrate-audio laesst INI-Kommentare stehen
+> teefax.ini echo #   --audio-open-ms 500       Audio device start-up time in ms (written by --calibrate-audio)
+>>teefax.ini echo #   --audio-latency-ms 0      Audio output latency in ms (written by --calibrate-audio)
+>>teefax.ini echo #--audio-latency-ms 40
+>>teefax.ini echo --audio-open-ms 500 --lang de
+"%EXE%" --calibrate-audio >nul 2>&1
+if errorlevel 1 goto calib_skip
+findstr /b /c:"#   --audio-open-ms 500       Audio device" teefax.ini >nul 2>&1
+call :chk %errorlevel% 0
+set T=--calibrate-audio laesst Zeile mit weiteren Schaltern stehen
+findstr /x /c:"--audio-open-ms 500 --lang de" teefax.ini >nul 2>&1
+call :chk %errorlevel% 0
+set T=--calibrate-audio ersetzt #--audio-latency-ms
+findstr /b /c:"#--audio-latency-ms" teefax.ini >nul 2>&1
+call :chk %errorlevel% 1
+set T=--calibrate-audio haengt --audio-open-ms an
+findstr /r /x /c:"--audio-open-ms [0-9]*" teefax.ini >nul 2>&1
+call :chk %errorlevel% 0
+goto calib_done
+:calib_skip
+echo   [SKIP] %T%   (kein Audiogeraet)
+:calib_done
+del teefax.ini >nul 2>&1
+
 rem ── 7. Makro-System ──────────────────────────────────────────────────
 rem  Laueft komplett in einer temporaeren INI, die danach geloescht wird.
 rem  Voraussetzung: keine teefax.ini im Ordner (s. Hinweis oben).
@@ -266,6 +405,43 @@ set T=--prealarm-Sekundenwert bleibt unquotiert (reine Zahl)
 call :chk %errorlevel% 0
 "%EXE%" --macro remove ttest >nul 2>&1
 
+set T=Makro-Cache folgt geaenderter INI (Exit 1 nach Umdefinition)
+"%EXE%" --macro add ttest 1s --mute --nomsg >nul 2>&1
+"%EXE%" ttest >nul 2>&1
+"%EXE%" --macro remove ttest >nul 2>&1
+"%EXE%" --macro add ttest dummy --xyzunknown >nul 2>&1
+"%EXE%" ttest >nul 2>&1
+call :chk %errorlevel% 1
+"%EXE%" --macro remove ttest >nul 2>&1
+
+set T=--macro add haengt an INI ohne abschliessenden Zeilenumbruch sauber an
+<nul set /p "=--mute" > teefax.ini
+"%EXE%" --macro add ttest 1s --nomsg >nul 2>&1
+findstr /x /c:"--mute" teefax.ini >nul 2>&1
+call :chk %errorlevel% 0
+"%EXE%" --macro remove ttest >nul 2>&1
+del teefax.ini >nul 2>&1
+
+set T=Verschachteltes Makro mit Parameter (Exit 0)
+"%EXE%" --macro add "tinner(d)" $d --mute --nomsg >nul 2>&1
+"%EXE%" --macro add touter tinner 1s >nul 2>&1
+"%EXE%" touter >nul 2>&1
+call :chk %errorlevel% 0
+
+set T=Makro mit fehlendem Argument gibt Exit 1
+"%EXE%" tinner >nul 2>&1
+call :chk %errorlevel% 1
+"%EXE%" --macro remove touter >nul 2>&1
+"%EXE%" --macro remove tinner >nul 2>&1
+
+set T=Makro-Zyklus gibt Exit 1
+"%EXE%" --macro add tcyca tcycb >nul 2>&1
+"%EXE%" --macro add tcycb tcyca >nul 2>&1
+"%EXE%" tcyca >nul 2>&1
+call :chk %errorlevel% 1
+"%EXE%" --macro remove tcyca >nul 2>&1
+"%EXE%" --macro remove tcycb >nul 2>&1
+
 set T=--macro remove nicht-vorhandenes Makro gibt Exit 1
 "%EXE%" --macro remove ttest_nx >nul 2>&1
 call :chk %errorlevel% 1
@@ -287,6 +463,8 @@ if exist teefax.ini (
     findstr /v /i "^macro " teefax.ini >nul 2>&1
     if errorlevel 1 del teefax.ini >nul 2>&1
 )
+if exist teefax.cache del teefax.cache >nul 2>&1
+if exist teefax.lock del teefax.lock >nul 2>&1
 
 rem ── Ergebnis ─────────────────────────────────────────────────────────
 